@@ -0,0 +1,387 @@
+// Benchmark suite for the hot paths on seeded maps of several sizes:
+// pathfinding by distance class, tile lookups, view culling and hexagon
+// drawing, the city turn stages, unit movement, whole simulation ticks and
+// a log call that is filtered out or held back by its rate limit.
+// Every benchmark reports ns/op (mean and percentiles over its samples) and
+// heap allocations per op, so regressions in either show up; the bench is
+// always built with the AllocationTracker hook.
+// The culling and drawing benchmarks need the Graphics module and are only
+// built in with HEXMAP_BENCH_RENDER; drawing also reports what each hexagon
+// submits, counted by DrawTarget.
+#include "AllocationTracker.hpp"
+#include "Definitions.hpp"
+#include "FrameArena.hpp"
+#include "HexGrid.hpp"
+#include "Log.hpp"
+#include "PathFinder.hpp"
+#include "Simulation.hpp"
+#include "Systems.hpp"
+#include "ThreadPool.hpp"
+#include "TurnEvents.hpp"
+#ifdef HEXMAP_BENCH_RENDER
+#include "DrawTarget.hpp"
+#include "RomanUI.hpp"
+#include "WorldRenderer.hpp"
+#endif
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <cstdio>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Results land here so the optimizer keeps the work
+volatile std::size_t sink = 0;
+
+struct BenchOptions {
+    int samples = 30;        // Timed batches per benchmark, after one warm-up batch
+    int units = 20000;       // Moving units for the movement and tick benchmarks
+    unsigned int seed = 1;
+    std::string filter;      // Only run benchmarks whose name contains this
+    bool quick = false;      // Smallest map only
+};
+
+struct MapSize {
+    const char* label;
+    int width;
+    int height;
+};
+
+const MapSize MAP_SIZES[] = {
+    {"small", 60, 45},
+    {"medium", 120, 90},
+    {"large", 240, 180},
+};
+
+const float HEX_SIZE = 30.0f;
+
+bool parseArguments(int argc, char* argv[], BenchOptions& options) {
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        bool hasValue = i + 1 < argc;
+
+        if (std::strcmp(arg, "--samples") == 0 && hasValue) {
+            options.samples = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "--units") == 0 && hasValue) {
+            options.units = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "--seed") == 0 && hasValue) {
+            options.seed = static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(arg, "--filter") == 0 && hasValue) {
+            options.filter = argv[++i];
+        } else if (std::strcmp(arg, "--quick") == 0) {
+            options.quick = true;
+        } else {
+            return false;
+        }
+    }
+    return options.samples > 0 && options.units >= 0;
+}
+
+// Prints one row per benchmark
+class Reporter {
+private:
+    std::ostream out;
+    const BenchOptions& options;
+
+    static double percentile(const std::vector<double>& sorted, int p) {
+        size_t index = std::min(sorted.size() - 1, sorted.size() * p / 100);
+        return sorted[index];
+    }
+
+public:
+    Reporter(std::streambuf* console, const BenchOptions& benchOptions)
+        : out(console), options(benchOptions) {
+        out << std::fixed << std::setprecision(1);
+    }
+
+    std::ostream& stream() { return out; }
+
+    void header() {
+        out << std::left << std::setw(28) << "benchmark" << std::setw(8) << "map"
+            << std::right << std::setw(12) << "ns/op" << std::setw(12) << "p50"
+            << std::setw(12) << "p90" << std::setw(12) << "p99" << std::setw(12) << "allocs/op" << "\n";
+    }
+
+    // Times samples batches of opsPerSample calls to op(i), after one warm-up
+    // batch. i keeps counting across batches so inputs can be cycled.
+    template <typename Fn>
+    void run(const std::string& name, const char* map, int opsPerSample, Fn&& op) {
+        if (!options.filter.empty() && name.find(options.filter) == std::string::npos) return;
+
+        int next = 0;
+        for (int i = 0; i < opsPerSample; ++i) {
+            op(next++);
+        }
+
+        std::vector<double> nsPerOp;
+        nsPerOp.reserve(options.samples);
+        std::uint64_t allocationsBefore = AllocationTracker::getTotalCounters().allocations;
+        for (int sample = 0; sample < options.samples; ++sample) {
+            auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < opsPerSample; ++i) {
+                op(next++);
+            }
+            double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+            nsPerOp.push_back(ns / opsPerSample);
+        }
+        std::uint64_t allocations = AllocationTracker::getTotalCounters().allocations - allocationsBefore;
+
+        double mean = 0.0;
+        for (double ns : nsPerOp) {
+            mean += ns;
+        }
+        mean /= nsPerOp.size();
+        std::sort(nsPerOp.begin(), nsPerOp.end());
+
+        double totalOps = static_cast<double>(options.samples) * opsPerSample;
+        out << std::left << std::setw(28) << name << std::setw(8) << map
+            << std::right << std::setw(12) << mean << std::setw(12) << percentile(nsPerOp, 50)
+            << std::setw(12) << percentile(nsPerOp, 90) << std::setw(12) << percentile(nsPerOp, 99)
+            << std::setw(12) << allocations / totalOps << "\n";
+    }
+};
+
+bool isLand(const game::Tile& tile) {
+    return Definitions::getTerrain(tile.type).walkable;
+}
+
+std::vector<sf::Vector2i> collectLandTiles(Simulation& simulation) {
+    const auto& tileMap = simulation.getTileMap();
+    std::vector<sf::Vector2i> land;
+    for (int q = 0; q < simulation.getMapWidth(); ++q) {
+        for (int r = 0; r < simulation.getMapHeight(); ++r) {
+            if (isLand(tileMap[q][r])) {
+                land.push_back(sf::Vector2i(q, r));
+            }
+        }
+    }
+    return land;
+}
+
+// Land tile pairs whose hex distance falls in [minDistance, maxDistance]
+std::vector<std::pair<sf::Vector2i, sf::Vector2i>> makeRoutes(const std::vector<sf::Vector2i>& land,
+                                                              int minDistance, int maxDistance,
+                                                              std::mt19937& rng) {
+    std::vector<std::pair<sf::Vector2i, sf::Vector2i>> routes;
+    std::uniform_int_distribution<size_t> pick(0, land.size() - 1);
+    for (int attempt = 0; attempt < 200000 && routes.size() < 64; ++attempt) {
+        sf::Vector2i from = land[pick(rng)];
+        sf::Vector2i to = land[pick(rng)];
+        int distance = HexGrid::distance(from, to);
+        if (distance >= minDistance && distance <= maxDistance) {
+            routes.emplace_back(from, to);
+        }
+    }
+    return routes;
+}
+
+// Random points inside the map's bounding box
+std::vector<sf::Vector2f> makeWorldPoints(Simulation& simulation, int count, std::mt19937& rng) {
+    const auto& tileMap = simulation.getTileMap();
+    sf::Vector2f extent = tileMap.back().back().center;
+    std::uniform_real_distribution<float> x(0.0f, extent.x + HEX_SIZE);
+    std::uniform_real_distribution<float> y(0.0f, extent.y + HEX_SIZE);
+
+    std::vector<sf::Vector2f> points;
+    for (int i = 0; i < count; ++i) {
+        points.push_back(sf::Vector2f(x(rng), y(rng)));
+    }
+    return points;
+}
+
+// One city per ~150 tiles; spacing rules reject some
+void foundCities(Simulation& simulation, const std::vector<sf::Vector2i>& land, std::mt19937& rng) {
+    const auto& tileMap = simulation.getTileMap();
+    std::uniform_int_distribution<size_t> pick(0, land.size() - 1);
+    int attempts = simulation.getMapWidth() * simulation.getMapHeight() / 150;
+    for (int i = 0; i < attempts; ++i) {
+        sf::Vector2i tile = land[pick(rng)];
+        simulation.getCityManager().addCity(tileMap[tile.x][tile.y].center);
+    }
+}
+
+// Units on random land tiles, each walking a long multi-waypoint path
+void addWalkingUnits(Simulation& simulation, const std::vector<sf::Vector2i>& land, int count, std::mt19937& rng) {
+    const auto& tileMap = simulation.getTileMap();
+    World& world = simulation.getWorld();
+    std::uniform_int_distribution<size_t> pick(0, land.size() - 1);
+    for (int i = 0; i < count; ++i) {
+        sf::Vector2i start = land[pick(rng)];
+        Entity unit = simulation.getUnitManager().addUnit(tileMap[start.x][start.y].center, UnitType::Warrior);
+
+        std::vector<sf::Vector2f> path;
+        path.push_back(*world.getPosition(unit));
+        for (int waypoint = 0; waypoint < 8; ++waypoint) {
+            sf::Vector2i tile = land[pick(rng)];
+            path.push_back(tileMap[tile.x][tile.y].center);
+        }
+        Systems::setPath(world, unit, path);
+    }
+}
+
+void benchMap(Reporter& reporter, const BenchOptions& options, const MapSize& size) {
+    Simulation simulation(size.width, size.height, HEX_SIZE);
+    simulation.setSeed(options.seed);
+    simulation.setWorkerThreads(0);
+    simulation.initialize();
+    simulation.setActivity(true, true);
+
+    const auto& tileMap = simulation.getTileMap();
+    std::mt19937 rng(options.seed);
+    std::vector<sf::Vector2i> land = collectLandTiles(simulation);
+
+    // Pathfinding by distance class
+    struct DistanceClass {
+        const char* name;
+        int minDistance;
+        int maxDistance;
+    };
+    const DistanceClass classes[] = {
+        {"findPath short", 2, 6},
+        {"findPath medium", 10, 20},
+        {"findPath long", 30, 60},
+    };
+    FrameArena arena;
+    for (const auto& distanceClass : classes) {
+        auto routes = makeRoutes(land, distanceClass.minDistance, distanceClass.maxDistance, rng);
+        if (routes.empty()) continue;
+
+        reporter.run(distanceClass.name, size.label, static_cast<int>(routes.size()), [&](int i) {
+            const auto& route = routes[i % routes.size()];
+            sink = game::PathFinder::findPath(tileMap, route.first, route.second, 100).size();
+        });
+
+        // Search state from a frame arena, reset as a frame would
+        std::string arenaName = std::string(distanceClass.name) + " arena";
+        reporter.run(arenaName, size.label, static_cast<int>(routes.size()), [&](int i) {
+            const auto& route = routes[i % routes.size()];
+            arena.reset();
+            sink = game::PathFinder::findPath(tileMap, route.first, route.second, 100, &arena).size();
+        });
+    }
+
+    // Position to tile: the unit manager's nearest-center scan and the hex math
+    std::vector<sf::Vector2f> points = makeWorldPoints(simulation, 256, rng);
+    UnitManager& unitManager = simulation.getUnitManager();
+    reporter.run("worldPosToTilePos", size.label, 16, [&](int i) {
+        sink = unitManager.worldPosToTilePos(points[i % points.size()], tileMap).x;
+    });
+    reporter.run("HexGrid::worldToTile", size.label, 256, [&](int i) {
+        sink = HexGrid::worldToTile(points[i % points.size()], HEX_SIZE, size.width, size.height).x;
+    });
+
+#ifdef HEXMAP_BENCH_RENDER
+    // A 1280x720 view panned around the map
+    WorldRenderer renderer(HEX_SIZE);
+    renderer.setTileMap(tileMap);
+    std::pmr::vector<size_t> inView;
+    reporter.run("tile culling", size.label, 16, [&](int i) {
+        sf::View view(points[i % points.size()], sf::Vector2f(1280.0f, 720.0f));
+        renderer.collectTilesInView(view, inView);
+        sink = inView.size();
+    });
+
+    sf::RenderTexture texture;
+    if (texture.resize(sf::Vector2u(1280, 720))) {
+        DrawTarget target(texture);
+        target.setCategory(DrawCategory::Terrain);
+        reporter.run("drawRomanHexagon2D5", size.label, 256, [&](int i) {
+            sf::Vector2i tile = land[i % land.size()];
+            RomanUI::drawRomanHexagon2D5(target, tileMap[tile.x][tile.y], HEX_SIZE);
+        });
+        texture.display();
+
+        // What one hexagon submits, for batching work
+        const int hexagons = 256;
+        target.beginFrame();
+        for (int i = 0; i < hexagons; ++i) {
+            sf::Vector2i tile = land[i % land.size()];
+            RomanUI::drawRomanHexagon2D5(target, tileMap[tile.x][tile.y], HEX_SIZE);
+        }
+        DrawTally tally = target.getFrameStats().total();
+        reporter.stream() << "  per hexagon: " << static_cast<double>(tally.drawCalls) / hexagons << " draw calls, "
+                          << static_cast<double>(tally.vertices) / hexagons << " vertices, "
+                          << static_cast<double>(tally.textureBinds) / hexagons << " texture binds\n";
+    }
+#endif
+
+    // City turn stages on one thread, as in TurnPipeline
+    foundCities(simulation, land, rng);
+    simulation.tick();  // Territory and worked tiles for the new cities
+
+    game::CityManager& cityManager = simulation.getCityManager();
+    ThreadPool pool(0);
+    TurnEvents events;
+    std::string cityLabel = "city turn (" + std::to_string(cityManager.getCityCount()) + ")";
+    reporter.run(cityLabel, size.label, 4, [&](int) {
+        events.clear();
+        cityManager.applyWorkedYields(simulation.getTileYields(), pool);
+        cityManager.processProduction(pool, events);
+        cityManager.processGrowth(pool);
+    });
+
+    if (options.units == 0) return;
+
+    // Unit movement, then the whole tick that wraps it
+    addWalkingUnits(simulation, land, options.units, rng);
+    World& world = simulation.getWorld();
+    MovementBatch batch;
+    const float deltaTime = simulation.getTickDuration();
+    std::string unitLabel = "unit movement (" + std::to_string(options.units) + ")";
+    reporter.run(unitLabel, size.label, 4, [&](int) {
+        Systems::storePreviousPositions(world);
+        Systems::updateMovement(world, batch, deltaTime);
+    });
+
+    reporter.run("simulation tick", size.label, 4, [&](int) {
+        simulation.tick();
+    });
+}
+
+// What a LOG_* call in a hot path costs when nothing gets printed
+void benchLogging(Reporter& reporter) {
+    reporter.run("log filtered", "-", 100000, [&](int i) {
+        LOG_INFO("bench", "filtered {}", i);
+    });
+
+    // Anything the limit lets through goes to a scratch file
+    std::FILE* scratch = std::tmpfile();
+    if (!scratch) return;
+    Log::Options logOptions;
+    logOptions.sink = scratch;
+    Log::start(logOptions);
+    reporter.run("log rate limited", "-", 100000, [&](int i) {
+        LOG_INFO("bench", "rate limited {}", i);
+    });
+    Log::stop();
+    std::fclose(scratch);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    BenchOptions options;
+    if (!parseArguments(argc, argv, options)) {
+        std::cout << "Usage: " << argv[0] << " [--samples N] [--units N] [--seed S] [--filter TEXT] [--quick]\n";
+        return 1;
+    }
+
+    // The game's own logging is off, as Log::start() is never called for it
+    Reporter reporter(std::cout.rdbuf(), options);
+
+    reporter.stream() << "seed " << options.seed << ", " << options.samples << " samples per benchmark\n";
+    reporter.header();
+    for (const auto& size : MAP_SIZES) {
+        benchMap(reporter, options, size);
+        if (options.quick) break;
+    }
+    benchLogging(reporter);
+
+    return 0;
+}
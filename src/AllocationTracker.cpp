@@ -0,0 +1,151 @@
+#include "AllocationTracker.hpp"
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+namespace {
+    // Plain thread locals only: the hook runs before anything else is set up
+    struct ThreadState {
+        std::uint64_t allocations;
+        std::uint64_t bytes;
+        int noAllocDepth;
+        const char* noAllocRegion;
+        bool reporting;
+    };
+    thread_local ThreadState threadState;
+
+    std::atomic<std::uint64_t> totalAllocations{0};
+    std::atomic<std::uint64_t> totalBytes{0};
+    std::atomic<std::uint64_t> violations{0};
+
+    // Stderr gets the first few violations; the counter gets all of them
+    const std::uint64_t MAX_REPORTED_VIOLATIONS = 20;
+
+#ifdef HEXMAP_NO_ALLOC_ASSERT
+    std::atomic<AllocationTracker::NoAllocPolicy> policy{AllocationTracker::NoAllocPolicy::Abort};
+#else
+    std::atomic<AllocationTracker::NoAllocPolicy> policy{AllocationTracker::NoAllocPolicy::Report};
+#endif
+
+#ifdef HEXMAP_TRACK_ALLOCATIONS
+    void reportViolation(std::size_t size, std::uint64_t index) {
+        AllocationTracker::NoAllocPolicy current = policy.load(std::memory_order_relaxed);
+        if (current == AllocationTracker::NoAllocPolicy::Count) return;
+        if (current == AllocationTracker::NoAllocPolicy::Report && index >= MAX_REPORTED_VIOLATIONS) return;
+
+        // Printing must not allocate back into the hook
+        threadState.reporting = true;
+        std::fprintf(stderr, "Allocation of %zu bytes inside no-alloc region \"%s\"\n",
+                     size, threadState.noAllocRegion ? threadState.noAllocRegion : "?");
+        if (current == AllocationTracker::NoAllocPolicy::Abort) {
+            std::abort();
+        }
+        if (index + 1 == MAX_REPORTED_VIOLATIONS) {
+            std::fprintf(stderr, "Further no-alloc violations are only counted\n");
+        }
+        threadState.reporting = false;
+    }
+
+    void recordAllocation(std::size_t size) {
+        ++threadState.allocations;
+        threadState.bytes += size;
+        totalAllocations.fetch_add(1, std::memory_order_relaxed);
+        totalBytes.fetch_add(size, std::memory_order_relaxed);
+
+        if (threadState.noAllocDepth > 0 && !threadState.reporting) {
+            reportViolation(size, violations.fetch_add(1, std::memory_order_relaxed));
+        }
+    }
+#endif
+}
+
+#ifdef HEXMAP_TRACK_ALLOCATIONS
+
+// Array forms and the nothrow forms of the standard library go through these
+
+void* operator new(std::size_t size) {
+    recordAllocation(size);
+    if (void* memory = std::malloc(size ? size : 1)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    recordAllocation(size);
+    std::size_t align = static_cast<std::size_t>(alignment);
+    std::size_t rounded = (size + align - 1) / align * align;
+    if (void* memory = std::aligned_alloc(align, rounded ? rounded : align)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::align_val_t) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t, std::align_val_t) noexcept {
+    std::free(memory);
+}
+
+#endif
+
+namespace AllocationTracker {
+
+bool isEnabled() {
+#ifdef HEXMAP_TRACK_ALLOCATIONS
+    return true;
+#else
+    return false;
+#endif
+}
+
+Counters getThreadCounters() {
+    Counters counters;
+    counters.allocations = threadState.allocations;
+    counters.bytes = threadState.bytes;
+    return counters;
+}
+
+Counters getTotalCounters() {
+    Counters counters;
+    counters.allocations = totalAllocations.load(std::memory_order_relaxed);
+    counters.bytes = totalBytes.load(std::memory_order_relaxed);
+    return counters;
+}
+
+std::uint64_t getViolationCount() {
+    return violations.load(std::memory_order_relaxed);
+}
+
+void setNoAllocPolicy(NoAllocPolicy noAllocPolicy) {
+    policy.store(noAllocPolicy, std::memory_order_relaxed);
+}
+
+NoAllocPolicy getNoAllocPolicy() {
+    return policy.load(std::memory_order_relaxed);
+}
+
+void enterNoAllocRegion(const char* name) {
+    if (threadState.noAllocDepth++ == 0) {
+        threadState.noAllocRegion = name;
+    }
+}
+
+void leaveNoAllocRegion() {
+    if (--threadState.noAllocDepth == 0) {
+        threadState.noAllocRegion = nullptr;
+    }
+}
+
+} // namespace AllocationTracker
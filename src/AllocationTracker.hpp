@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+
+// Opt-in heap allocation accounting.
+// Built with HEXMAP_TRACK_ALLOCATIONS, the global operator new counts every
+// allocation and its size, per thread and for the whole process. Profiler
+// scopes read the per-thread counters, so frames and scopes report what they
+// allocated. Without the define the hook is not compiled in and every
+// counter reads zero.
+//
+// NoAllocScope marks code that must not allocate once warmed up. An
+// allocation inside one is a violation: counted, reported on stderr, or,
+// with HEXMAP_NO_ALLOC_ASSERT, fatal.
+namespace AllocationTracker {
+    struct Counters {
+        std::uint64_t allocations = 0;
+        std::uint64_t bytes = 0;
+    };
+
+    enum class NoAllocPolicy {
+        Count,   // Only bump the violation counter
+        Report,  // Also print the region to stderr, a limited number of times
+        Abort    // Print and abort, to catch the allocation in a debugger
+    };
+
+    // Whether the allocation hook is compiled in
+    bool isEnabled();
+
+    // Allocations made so far by the calling thread
+    Counters getThreadCounters();
+
+    // Allocations made so far by all threads
+    Counters getTotalCounters();
+
+    // Allocations inside no-alloc regions so far, all threads
+    std::uint64_t getViolationCount();
+
+    void setNoAllocPolicy(NoAllocPolicy policy);
+    NoAllocPolicy getNoAllocPolicy();
+
+    // Regions nest; name is reported on violations and must outlive the region
+    void enterNoAllocRegion(const char* name);
+    void leaveNoAllocRegion();
+}
+
+// Marks its enclosing block as a no-alloc region on the calling thread
+class NoAllocScope {
+public:
+    explicit NoAllocScope(const char* name) { AllocationTracker::enterNoAllocRegion(name); }
+    ~NoAllocScope() { AllocationTracker::leaveNoAllocRegion(); }
+
+    NoAllocScope(const NoAllocScope&) = delete;
+    NoAllocScope& operator=(const NoAllocScope&) = delete;
+};
@@ -1,11 +1,12 @@
 #pragma once
 
-#include "PlayerUnit.hpp"
-#include <SFML/Graphics.hpp>
+#include "Ecs.hpp"
+#include "InternedString.hpp"
+#include <SFML/System/Vector2.hpp>
 #include <vector>
 #include <string>
 
-// Forward declaration for circular reference
+// Forward declaration
 class Hero;
 
 // Unit type for armies
@@ -16,9 +17,10 @@ enum class ArmyUnitType {
     Mage
 };
 
-// Unit structure for army units (not to be confused with PlayerUnit)
+// Unit structure for army units (not to be confused with map units).
+// Plain values and an interned name, so buying and copying units never allocates.
 struct ArmyUnit {
-    std::string name;
+    InternedString name;
     ArmyUnitType type;
     int health;
     int maxHealth;
@@ -26,7 +28,7 @@ struct ArmyUnit {
     int defense;
     int cost;
     
-    ArmyUnit(const std::string& n, ArmyUnitType t, int h, int a, int d, int c) 
+    ArmyUnit(InternedString n, ArmyUnitType t, int h, int a, int d, int c) 
         : name(n), type(t), health(h), maxHealth(h), attack(a), defense(d), cost(c) {}
 };
 
@@ -34,7 +36,7 @@ struct ArmyUnit {
 class Army {
 private:
     std::vector<ArmyUnit> units;
-    Hero* leader;
+    Entity leader;  // Hero entity leading this army
     
     // Maximum unit capacity
     int maxUnits;
@@ -42,11 +44,8 @@ private:
     // Army formation information
     std::vector<sf::Vector2f> formationOffsets;
     
-    // Visual representations
-    std::vector<sf::CircleShape> unitShapes;
-    
 public:
-    Army(Hero* heroLeader, int capacity = 8);
+    explicit Army(Entity heroLeader, int capacity = 8);
     
     // Unit management
     bool addUnit(const ArmyUnit& unit);
@@ -59,22 +58,17 @@ public:
     const std::vector<ArmyUnit>& getUnits() const { return units; }
     
     // Get leader
-    Hero* getLeader() const { return leader; }
-    void setLeader(Hero* newLeader) { leader = newLeader; }
-    
-    // Calculate army strength
-    int getTotalAttack() const;
-    int getTotalDefense() const;
+    Entity getLeader() const { return leader; }
+    void setLeader(Entity newLeader) { leader = newLeader; }
     
-    // Update formation positions based on hero position
-    void updateFormation(const sf::Vector2f& leaderPos);
+    // Calculate army strength, including the bonus of the leading hero if given
+    int getTotalAttack(const Hero* leaderHero) const;
+    int getTotalDefense(const Hero* leaderHero) const;
     
-    // Drawing
-    void draw(sf::RenderWindow& window);
+    // Offset of each formation slot relative to the leader.
+    // The renderer places army markers at leader position + offset.
+    const std::vector<sf::Vector2f>& getFormationOffsets() const { return formationOffsets; }
     
     // Calculate cost of all units
     int getTotalCost() const;
-    
-    // Create default unit shapes
-    void createUnitShapes();
 };
\ No newline at end of file
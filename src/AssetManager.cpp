@@ -0,0 +1,236 @@
+#include "AssetManager.hpp"
+#include "Log.hpp"
+
+AssetManager::AssetManager(const std::string& executablePath)
+    : hotReload(false), stopping(false), fileLoads(0), reloads(0) {
+    std::error_code error;
+    if (!executablePath.empty()) {
+        std::filesystem::path executable = std::filesystem::absolute(executablePath, error);
+        if (!error) {
+            searchRoots.push_back(executable.parent_path());
+            searchRoots.push_back(executable.parent_path().parent_path());
+        }
+    }
+    std::filesystem::path workingDirectory = std::filesystem::current_path(error);
+    if (!error) {
+        searchRoots.push_back(workingDirectory);
+    }
+
+    loader = std::thread(&AssetManager::runLoader, this);
+}
+
+AssetManager::~AssetManager() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_one();
+    loader.join();
+}
+
+const std::string& AssetManager::resolve(const std::string& path) {
+    auto known = resolvedPaths.find(path);
+    if (known != resolvedPaths.end()) {
+        return known->second;
+    }
+
+    std::string resolved;
+    std::error_code error;
+    std::filesystem::path requested(path);
+    if (requested.is_absolute()) {
+        if (std::filesystem::is_regular_file(requested, error)) {
+            resolved = requested.lexically_normal().string();
+        }
+    } else {
+        for (const std::filesystem::path& root : searchRoots) {
+            std::filesystem::path candidate = root / requested;
+            if (std::filesystem::is_regular_file(candidate, error)) {
+                resolved = std::filesystem::weakly_canonical(candidate, error).string();
+                break;
+            }
+        }
+    }
+    return resolvedPaths.emplace(path, resolved).first->second;
+}
+
+std::shared_ptr<AssetManager::Asset> AssetManager::request(Kind kind, const std::vector<std::string>& candidates) {
+    std::string path;
+    for (const std::string& candidate : candidates) {
+        path = resolve(candidate);
+        if (!path.empty()) break;
+    }
+
+    if (path.empty()) {
+        LOG_ERROR("asset", "Asset not found: {}", candidates.empty() ? std::string() : candidates.front());
+        auto missing = std::make_shared<Asset>();
+        missing->kind = kind;
+        missing->state = State::Failed;
+        return missing;
+    }
+
+    std::shared_ptr<Asset> asset;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto cached = cache.find(path);
+        if (cached != cache.end()) {
+            return cached->second;
+        }
+
+        asset = std::make_shared<Asset>();
+        asset->kind = kind;
+        asset->path = path;
+        cache.emplace(path, asset);
+        loadQueue.push_back(asset);
+    }
+    wake.notify_one();
+    return asset;
+}
+
+AssetManager::FontHandle AssetManager::loadFont(const std::vector<std::string>& candidates) {
+    return FontHandle(request(Kind::Font, candidates));
+}
+
+AssetManager::TextureHandle AssetManager::loadTexture(const std::string& path) {
+    return TextureHandle(request(Kind::Texture, {path}));
+}
+
+void AssetManager::runLoader() {
+    std::unique_lock<std::mutex> lock(mutex);
+    auto hasWork = [this] { return stopping || !loadQueue.empty(); };
+
+    for (;;) {
+        if (!hasWork()) {
+            if (!hotReload) {
+                wake.wait(lock, hasWork);
+            } else if (!wake.wait_for(lock, HOT_RELOAD_INTERVAL, hasWork)) {
+                lock.unlock();
+                checkForChanges();
+                lock.lock();
+                continue;
+            }
+        }
+        if (stopping) return;
+
+        std::shared_ptr<Asset> asset = std::move(loadQueue.front());
+        loadQueue.pop_front();
+
+        // File reads and decoding happen here, off the render thread
+        lock.unlock();
+        load(*asset);
+        lock.lock();
+
+        ++fileLoads;
+        if (asset->reloading) ++reloads;
+        finishedQueue.push_back(std::move(asset));
+    }
+}
+
+void AssetManager::load(Asset& asset) {
+    std::error_code error;
+    asset.modified = std::filesystem::last_write_time(asset.path, error);
+    asset.stagedOk = asset.kind == Kind::Font ? asset.stagedFont.openFromFile(asset.path)
+                                              : asset.stagedImage.loadFromFile(asset.path);
+}
+
+void AssetManager::checkForChanges() {
+    std::vector<std::shared_ptr<Asset>> watched;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (const auto& entry : cache) {
+            const Asset& asset = *entry.second;
+            if (!asset.reloading && asset.state.load(std::memory_order_acquire) != State::Pending) {
+                watched.push_back(entry.second);
+            }
+        }
+    }
+
+    for (const std::shared_ptr<Asset>& asset : watched) {
+        std::error_code error;
+        std::filesystem::file_time_type modified = std::filesystem::last_write_time(asset->path, error);
+        if (error || modified == asset->modified) continue;
+
+        LOG_INFO("asset", "Reloading {}", asset->path);
+        std::lock_guard<std::mutex> lock(mutex);
+        asset->reloading = true;
+        loadQueue.push_back(asset);
+    }
+}
+
+std::size_t AssetManager::update() {
+    std::vector<std::shared_ptr<Asset>> finished;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        finished.swap(finishedQueue);
+    }
+
+    for (const std::shared_ptr<Asset>& asset : finished) {
+        // Fonts and textures are replaced in place, so text and sprites
+        // drawing with them see the new contents
+        bool ok = asset->stagedOk;
+        if (ok && asset->kind == Kind::Font) {
+            asset->font = std::move(asset->stagedFont);
+            asset->stagedFont = sf::Font();
+        } else if (ok) {
+            ok = asset->texture.loadFromImage(asset->stagedImage);
+            asset->stagedImage = sf::Image();
+        }
+
+        // A failed reload keeps what was loaded before
+        if (ok) {
+            asset->state.store(State::Ready, std::memory_order_release);
+        } else {
+            LOG_ERROR("asset", "Failed to load {}", asset->path);
+            if (asset->state.load(std::memory_order_relaxed) == State::Pending) {
+                asset->state.store(State::Failed, std::memory_order_release);
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        asset->reloading = false;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    std::size_t pending = 0;
+    for (const auto& entry : cache) {
+        if (entry.second->state.load(std::memory_order_acquire) == State::Pending) ++pending;
+    }
+    return pending;
+}
+
+void AssetManager::setHotReload(bool enabled) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        hotReload = enabled;
+    }
+    wake.notify_one();
+}
+
+std::size_t AssetManager::releaseUnused() {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::size_t released = 0;
+    for (auto it = cache.begin(); it != cache.end();) {
+        // The cache's own reference is the only one left
+        if (it->second.use_count() == 1) {
+            it = cache.erase(it);
+            ++released;
+        } else {
+            ++it;
+        }
+    }
+    return released;
+}
+
+std::size_t AssetManager::getCachedCount() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return cache.size();
+}
+
+std::size_t AssetManager::getFileLoadCount() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return fileLoads;
+}
+
+std::size_t AssetManager::getReloadCount() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return reloads;
+}
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+// One cache for every font and texture the game draws with.
+// Paths are resolved once against the executable's directory, its parent
+// and the working directory, and each resolved file is loaded exactly
+// once; everyone asking for it shares the same handle. A loader thread
+// reads and decodes files while the caller keeps presenting frames, and
+// update(), called on the thread that owns the window, moves finished
+// loads into place and uploads textures. With hot reload on, the loader
+// also watches loaded files and reloads any that change on disk, into the
+// same font or texture object, so existing text and sprites pick it up.
+class AssetManager {
+public:
+    enum class State {
+        Pending,
+        Ready,
+        Failed
+    };
+
+private:
+    enum class Kind {
+        Font,
+        Texture
+    };
+
+    struct Asset {
+        Kind kind;
+        std::string path;                     // Resolved; the cache key
+        std::atomic<State> state{State::Pending};
+        sf::Font font;
+        sf::Texture texture;
+
+        std::filesystem::file_time_type modified;  // Loader thread only
+        bool reloading = false;                    // Guarded by the mutex
+
+        // Filled by the loader, moved into place by update()
+        sf::Font stagedFont;
+        sf::Image stagedImage;
+        bool stagedOk = false;
+    };
+
+public:
+    // Shared reference to a cached asset; the cache keeps an asset while
+    // any handle to it is alive
+    template <typename T>
+    class Handle {
+    private:
+        friend class AssetManager;
+        std::shared_ptr<const Asset> asset;
+
+        explicit Handle(std::shared_ptr<const Asset> cached) : asset(std::move(cached)) {}
+
+    public:
+        Handle() = default;
+
+        explicit operator bool() const { return asset != nullptr; }
+
+        State getState() const { return asset ? asset->state.load(std::memory_order_acquire) : State::Failed; }
+        bool isReady() const { return getState() == State::Ready; }
+        bool isDone() const { return getState() != State::Pending; }
+
+        // Only valid once ready
+        const T& get() const {
+            if constexpr (std::is_same_v<T, sf::Font>) {
+                return asset->font;
+            } else {
+                return asset->texture;
+            }
+        }
+
+        // Resolved path; empty for a request nothing matched
+        const std::string& getPath() const { return asset->path; }
+    };
+
+    using FontHandle = Handle<sf::Font>;
+    using TextureHandle = Handle<sf::Texture>;
+
+private:
+    std::vector<std::filesystem::path> searchRoots;
+    std::unordered_map<std::string, std::string> resolvedPaths;  // Request path -> resolved, or empty
+
+    // Everything below is shared with the loader thread
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::unordered_map<std::string, std::shared_ptr<Asset>> cache;
+    std::deque<std::shared_ptr<Asset>> loadQueue;
+    std::vector<std::shared_ptr<Asset>> finishedQueue;
+    bool hotReload;
+    bool stopping;
+    std::size_t fileLoads;
+    std::size_t reloads;
+    std::thread loader;
+
+    std::shared_ptr<Asset> request(Kind kind, const std::vector<std::string>& candidates);
+    void runLoader();
+    void load(Asset& asset);
+    void checkForChanges();
+
+public:
+    static constexpr std::chrono::milliseconds HOT_RELOAD_INTERVAL{500};
+
+    // executablePath is argv[0]; relative asset paths are looked up next
+    // to it, one directory up, then in the working directory
+    explicit AssetManager(const std::string& executablePath = "");
+    ~AssetManager();
+
+    AssetManager(const AssetManager&) = delete;
+    AssetManager& operator=(const AssetManager&) = delete;
+
+    // Absolute path of an existing file, or empty; results are cached
+    const std::string& resolve(const std::string& path);
+
+    // The first candidate that resolves is the one loaded
+    FontHandle loadFont(const std::vector<std::string>& candidates);
+    TextureHandle loadTexture(const std::string& path);
+
+    // Put finished loads and reloads in place; call once per frame on the
+    // window's thread. Returns the number of assets still loading.
+    std::size_t update();
+
+    // Watch loaded files and reload them when they change
+    void setHotReload(bool enabled);
+
+    // Drop cached assets no handle refers to; returns how many went
+    std::size_t releaseUnused();
+
+    std::size_t getCachedCount();
+    // Files read from disk so far, reloads included
+    std::size_t getFileLoadCount();
+    std::size_t getReloadCount();
+};
@@ -1,13 +1,11 @@
 #include "City.hpp"
-#include <iostream>
+#include "Log.hpp"
 #include <algorithm>
-#include <SFML/Graphics.hpp>
 
 namespace game {
 
-GameCity::GameCity(const std::string& cityName, const sf::Vector2f& pos)
+GameCity::GameCity(const std::string& cityName)
     : name(cityName),
-      position(pos),
       population(1),
       food(2),
       production(2),
@@ -24,31 +22,47 @@ GameCity::GameCity(const std::string& cityName, const sf::Vector2f& pos)
       productionNeeded(50),
       maxBuildings(5)
 {
-    // Setup visual representation with larger, more visible city
-    cityShape.setRadius(20.0f);  // Increased for better visibility
-    cityShape.setOrigin(sf::Vector2f(20.0f, 20.0f)); 
-    cityShape.setFillColor(sf::Color(255, 215, 0));  // Gold color
-    cityShape.setOutlineColor(sf::Color::Black);
-    cityShape.setOutlineThickness(3.0f);
-    cityShape.setPosition(position);
-    
-    std::cout << "City created: " << name << " at position: " 
-              << position.x << ", " << position.y << std::endl;
+    LOG_DEBUG("city", "City created: {}", name);
 }
 
 void GameCity::addPopulation(int amount) {
     population += amount;
     if (population < 1) population = 1;
     
-    // Update city production based on population
-    food = 2 + (population - 1);
-    production = 2 + (population - 1);
-    goldPerTurn = 1 + (population / 2);
+    updateYields();
     
     // Adjust happiness
     happiness = std::min(happiness + (amount > 0 ? 5 : -5), maxHappiness);
 }
 
+void GameCity::setWorkedYield(const TileYield& yield) {
+    workedYield = yield;
+    updateYields();
+}
+
+void GameCity::updateYields() {
+    // Worked tiles, plus a little gold from the citizens themselves
+    food = workedYield.food;
+    production = workedYield.production;
+    goldPerTurn = workedYield.gold + 1 + (population / 2);
+    
+    for (BuildingType building : buildingTypes) {
+        switch (building) {
+            case BuildingType::GRANARY:
+                food += 2;
+                break;
+            case BuildingType::WORKSHOP:
+                production += 2;
+                break;
+            case BuildingType::MARKETPLACE:
+                goldPerTurn += 2;
+                break;
+            default:
+                break;
+        }
+    }
+}
+
 void GameCity::addFood(int amount) {
     storedFood += amount;
     
@@ -110,31 +124,28 @@ void GameCity::setProductionItem(ProductionItem item) {
 void GameCity::addBuilding(BuildingType building) {
     // Check if city can add more buildings
     if (buildingTypes.size() >= maxBuildings) {
-        std::cout << "Cannot add more buildings to " << name << std::endl;
+        LOG_INFO("city", "Cannot add more buildings to {}", name);
         return;
     }
     
     // Check if building already exists
     if (std::find(buildingTypes.begin(), buildingTypes.end(), building) 
         != buildingTypes.end()) {
-        std::cout << "Building already exists in " << name << std::endl;
+        LOG_INFO("city", "Building already exists in {}", name);
         return;
     }
     
     // Add building and apply its effects
     buildingTypes.push_back(building);
+    updateYields();
     
-    // Apply building bonuses
+    // Apply building bonuses that aren't yields
     switch (building) {
         case BuildingType::GRANARY:
-            food += 2;
             happiness += 5;
             break;
         case BuildingType::WORKSHOP:
-            production += 2;
-            break;
         case BuildingType::MARKETPLACE:
-            goldPerTurn += 2;
             break;
         case BuildingType::LIBRARY:
             science += 1;
@@ -146,7 +157,7 @@ void GameCity::addBuilding(BuildingType building) {
     }
 }
 
-bool GameCity::processTurn() {
+bool GameCity::processProduction() {
     // Process production
     productionProgress += production;
     
@@ -154,19 +165,24 @@ bool GameCity::processTurn() {
     addScience(1);
     
     // Check if production is complete
-    if (productionProgress >= productionNeeded) {
-        productionProgress -= productionNeeded;
-        
-        // Check if there's another item in the queue
-        if (!productionQueue.empty()) {
-            currentProduction = productionQueue.front();
-            productionQueue.erase(productionQueue.begin());
-            return true;
-        }
-        
-        return true; // Item completed
+    if (productionProgress < productionNeeded) {
+        return false;
+    }
+    productionProgress -= productionNeeded;
+    
+    // Move on to the next queued item, keeping the overflow;
+    // with nothing queued the same item is built again
+    if (!productionQueue.empty()) {
+        int overflow = productionProgress;
+        setProductionItem(productionQueue.front());
+        productionQueue.pop_front();
+        productionProgress = overflow;
     }
     
+    return true; // Item completed
+}
+
+void GameCity::processGrowth() {
     // Process food and gold
     addFood(food);
     addGold(goldPerTurn);
@@ -181,58 +197,28 @@ bool GameCity::processTurn() {
         production = std::max(0, production - 1);
         goldPerTurn = std::max(0, goldPerTurn - 1);
     }
-    
-    return false; // No item completed
 }
 
-void GameCity::draw(sf::RenderWindow& window) {
-    // Draw the city shape
-    window.draw(cityShape);
-    
-    // Optional: Draw city name or population
-    static sf::Font font;
-    static bool fontLoaded = false;
-    
-    if (!fontLoaded) {
-        // Try multiple font paths
-        const std::vector<std::string> fontPaths = {
-            "arial.ttf",                  // Current directory
-            "../assets/arial.ttf",        // Parent directory's assets folder
-            "assets/arial.ttf",           // Assets folder in current directory
-            "../fonts/OpenSans-Regular.ttf", // Parent directory's fonts folder
-            "fonts/OpenSans-Regular.ttf", // Fonts folder in current directory
-            "/System/Library/Fonts/Supplemental/Arial.ttf" // macOS system font
-        };
-        
-        for (const auto& path : fontPaths) {
-            if (font.openFromFile(path)) {
-                fontLoaded = true;
-                break;
-            }
-        }
-    }
-    
-    if (fontLoaded) {
-        sf::Text cityText(font, name + "\nPop: " + std::to_string(population), 12);
-        cityText.setFillColor(sf::Color::Black);
-        cityText.setPosition(sf::Vector2f(position.x - 20, position.y + 25));
-        window.draw(cityText);
-    } else {
-        std::cerr << "Failed to load font for city text" << std::endl;
+bool GameCity::isUnit(ProductionItem item) {
+    return item == ProductionItem::SETTLER ||
+           item == ProductionItem::WARRIOR ||
+           item == ProductionItem::BUILDER;
+}
+
+UnitType GameCity::getUnitType(ProductionItem item) {
+    switch (item) {
+        case ProductionItem::WARRIOR: return UnitType::Warrior;
+        case ProductionItem::BUILDER: return UnitType::Builder;
+        default: return UnitType::Settler;
     }
 }
 
-bool GameCity::contains(const sf::Vector2f& point) const {
-    // Expand hitbox for easier selection
-    float expansionFactor = 1.5f;
-    float radius = cityShape.getRadius() * expansionFactor;
-    
-    // Distance check
-    float dx = point.x - position.x;
-    float dy = point.y - position.y;
-    float distanceSquared = dx*dx + dy*dy;
-    
-    return distanceSquared <= radius*radius;
+GameCity::BuildingType GameCity::getBuildingType(ProductionItem item) {
+    switch (item) {
+        case ProductionItem::WORKSHOP: return BuildingType::WORKSHOP;
+        case ProductionItem::WALLS: return BuildingType::WALLS;
+        default: return BuildingType::GRANARY;
+    }
 }
 
 std::string GameCity::getItemName(ProductionItem item) {
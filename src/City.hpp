@@ -2,7 +2,7 @@
 #define CITY_HPP
 
 #include "GameEntities.hpp"
-#include <SFML/Graphics.hpp>
+#include "RingBuffer.hpp"
 #include <string>
 #include <vector>
 
@@ -32,7 +32,6 @@ public:
     
 private:
     std::string name;
-    sf::Vector2f position;
     int population;
     int food;
     int production;
@@ -52,7 +51,7 @@ private:
     int scientistsCount;
     
     // Production queue
-    std::vector<ProductionItem> productionQueue;
+    RingBuffer<ProductionItem> productionQueue;
     ProductionItem currentProduction;
     int productionProgress;
     int productionNeeded;
@@ -61,14 +60,19 @@ private:
     std::vector<BuildingType> buildingTypes;
     int maxBuildings;
     
-    // Visual representation
-    sf::CircleShape cityShape;
+    // What the city's worked tiles produce
+    TileYield workedYield;
+    
+    // Food, production and gold from worked tiles, population and buildings
+    void updateYields();
     
 public:
-    GameCity(const std::string& cityName, const sf::Vector2f& pos);
+    // Radius of the drawn city marker; the pick radius is derived from it
+    static constexpr float RADIUS = 20.0f;
+    
+    explicit GameCity(const std::string& cityName);
     
     const std::string& getName() const { return name; }
-    const sf::Vector2f& getPosition() const { return position; }
     int getPopulation() const { return population; }
     int getFood() const { return food; }
     int getProduction() const { return production; }
@@ -81,22 +85,33 @@ public:
     void addGold(int amount);
     void addScience(int amount);
     
+    // Yields of the tiles the city works, from TileYieldCache
+    void setWorkedYield(const TileYield& yield);
+    const TileYield& getWorkedYield() const { return workedYield; }
+    
     void addBuilding(BuildingType building);
     
     void setProductionItem(ProductionItem item);
+    // Build item once the current one is done
+    void queueProduction(ProductionItem item) { productionQueue.push_back(item); }
+    size_t getQueuedCount() const { return productionQueue.size(); }
     ProductionItem getCurrentProduction() const { return currentProduction; }
     int getProductionProgress() const { return productionProgress; }
     int getProductionNeeded() const { return productionNeeded; }
     
-    // Returns true if an item was completed
-    bool processTurn();
-    
-    void draw(sf::RenderWindow& window);
-    bool contains(const sf::Vector2f& point) const;
+    // Turn phases, run in this order; both run every turn.
+    // processProduction returns true if an item was completed.
+    bool processProduction();
+    void processGrowth();
     
     // Utility methods
     static std::string getItemName(ProductionItem item);
     static std::string getBuildingName(BuildingType building);
+    
+    // What finishing an item yields; isUnit tells which one applies
+    static bool isUnit(ProductionItem item);
+    static UnitType getUnitType(ProductionItem item);
+    static BuildingType getBuildingType(ProductionItem item);
 };
 
 } // namespace game
@@ -1,16 +1,25 @@
 #include "CityManager.hpp"
-#include <iostream>
+#include "World.hpp"
+#include "ThreadPool.hpp"
+#include "TileYieldCache.hpp"
+#include "Log.hpp"
 #include <algorithm>
 #include <random>
 
 namespace game {
 
-CityManager::CityManager() 
-    : selectedCity(nullptr), 
+namespace {
+    // Cities per work item; a city turn is cheap, so small maps stay on one thread
+    const size_t CITY_TURN_GRAIN = 64;
+}
+
+CityManager::CityManager(World& gameWorld) 
+    : world(gameWorld), 
       nameIndex(0),
-      maxCities(10),  // Limit total number of cities
+      maxCities(0),  // No cap; spacing alone limits how many fit
       citySpawnCooldown(0.0f),
-      citySpawnInterval(300.0f)  // 5 minutes between city spawns
+      citySpawnInterval(300.0f),  // 5 minutes between city spawns
+      rng(std::random_device{}())
 {
     initializeCityNames();
 }
@@ -32,70 +41,137 @@ void CityManager::initializeCityNames() {
     };
 }
 
-void CityManager::addCity(const sf::Vector2f& position) {
+Entity CityManager::addCity(const sf::Vector2f& position) {
     // Check if we've reached maximum city limit
-    if (cities.size() >= maxCities) {
-        std::cout << "Maximum number of cities reached!" << std::endl;
-        return;
+    if (maxCities > 0 && getCityCount() >= maxCities) {
+        LOG_INFO("city", "Maximum number of cities reached");
+        return Entity{};
     }
     
     // Check for minimum distance between cities
     const float minCityDistance = 300.0f;
-    for (const auto& existingCity : cities) {
-        float dx = position.x - existingCity.getPosition().x;
-        float dy = position.y - existingCity.getPosition().y;
-        float distanceSquared = dx*dx + dy*dy;
-        
-        if (distanceSquared < minCityDistance * minCityDistance) {
-            std::cout << "Too close to an existing city!" << std::endl;
-            return;
-        }
+    if (world.findNearest(world.cities, position, minCityDistance).isValid()) {
+        LOG_INFO("city", "Too close to an existing city");
+        return Entity{};
     }
     
     // Get next city name
     std::string name = getNextCityName();
     
-    // Create and add the city
-    cities.emplace_back(name, position);
-    std::cout << "New city founded: " << name << std::endl;
+    // Create and add the city; the hitbox is expanded for easier selection
+    Entity city = world.create();
+    world.setPosition(city, position);
+    world.cities.add(city, name);
+    world.addSelectable(city, GameCity::RADIUS * 1.5f, false);
+    LOG_INFO("city", "New city founded: {}", name);
+    return city;
 }
 
-void CityManager::removeCity(size_t index) {
-    if (index < cities.size()) {
-        if (&cities[index] == selectedCity) {
-            selectedCity = nullptr;
-        }
-        cities.erase(cities.begin() + index);
+void CityManager::removeCity(Entity city) {
+    if (!world.cities.has(city)) return;
+    
+    if (city == selectedCity) {
+        selectedCity = Entity{};
     }
+    world.destroy(city);
 }
 
-GameCity* CityManager::getCityAt(size_t index) {
-    if (index < cities.size()) {
-        return &cities[index];
-    }
-    return nullptr;
+size_t CityManager::getCityCount() const {
+    return world.cities.size();
+}
+
+GameCity* CityManager::getCity(Entity city) {
+    return world.cities.get(city);
+}
+
+const sf::Vector2f* CityManager::getCityPosition(Entity city) const {
+    return world.cities.has(city) ? world.getPosition(city) : nullptr;
 }
 
 bool CityManager::selectCityAt(const sf::Vector2f& position) {
-    for (auto& city : cities) {
-        if (city.contains(position)) {
-            selectedCity = &city;
-            return true;
-        }
+    Entity city = world.pickAt(world.cities, position);
+    if (city.isValid()) {
+        selectedCity = city;
+        return true;
     }
     return false;
 }
 
 void CityManager::deselectCity() {
-    selectedCity = nullptr;
+    selectedCity = Entity{};
+}
+
+void CityManager::applyWorkedYields(const TileYieldCache& yields, ThreadPool& pool) {
+    std::vector<GameCity>& cities = world.cities.data();
+    const std::vector<Entity>& entities = world.cities.entities();
+    
+    // One worker per citizen, on top of the city center
+    pool.parallelFor(cities.size(), CITY_TURN_GRAIN, [&](size_t begin, size_t end, unsigned int) {
+        for (size_t i = begin; i < end; ++i) {
+            cities[i].setWorkedYield(yields.getYield(entities[i], cities[i].getPopulation()));
+        }
+    });
 }
 
-void CityManager::update(float deltaTime) {
-    // Update all cities
-    for (auto& city : cities) {
-        city.processTurn();
+void CityManager::processProduction(ThreadPool& pool, TurnEvents& events) {
+    std::vector<GameCity>& cities = world.cities.data();
+    
+    threadCompletions.resize(pool.getThreadCount());
+    for (auto& completions : threadCompletions) {
+        completions.clear();
+    }
+    
+    // Each city only touches its own state; anything that affects the rest of
+    // the world goes into the running thread's buffer
+    pool.parallelFor(cities.size(), CITY_TURN_GRAIN, [&](size_t begin, size_t end, unsigned int thread) {
+        auto& completions = threadCompletions[thread];
+        for (size_t i = begin; i < end; ++i) {
+            GameCity::ProductionItem item = cities[i].getCurrentProduction();
+            if (cities[i].processProduction()) {
+                completions.push_back(IndexedCompletion{i, item});
+            }
+        }
+    });
+    
+    // Which thread ran which city varies from run to run; city order doesn't
+    mergedCompletions.clear();
+    for (const auto& completions : threadCompletions) {
+        mergedCompletions.insert(mergedCompletions.end(), completions.begin(), completions.end());
     }
+    std::sort(mergedCompletions.begin(), mergedCompletions.end(),
+              [](const IndexedCompletion& a, const IndexedCompletion& b) { return a.cityIndex < b.cityIndex; });
     
+    for (const auto& completion : mergedCompletions) {
+        Entity city = world.cities.entityAt(completion.cityIndex);
+        if (GameCity::isUnit(completion.item)) {
+            events.unitsSpawned.push_back(UnitSpawnedEvent{city, GameCity::getUnitType(completion.item), *world.getPosition(city), world.getFaction(city)});
+        } else {
+            events.buildingsAdded.push_back(BuildingAddedEvent{city, GameCity::getBuildingType(completion.item)});
+        }
+        LOG_INFO("city", "{} completed {}", cities[completion.cityIndex].getName(),
+                 GameCity::getItemName(completion.item));
+    }
+}
+
+void CityManager::processGrowth(ThreadPool& pool) {
+    std::vector<GameCity>& cities = world.cities.data();
+    
+    pool.parallelFor(cities.size(), CITY_TURN_GRAIN, [&](size_t begin, size_t end, unsigned int) {
+        for (size_t i = begin; i < end; ++i) {
+            cities[i].processGrowth();
+        }
+    });
+}
+
+void CityManager::addBuildings(const std::vector<BuildingAddedEvent>& buildings) {
+    for (const auto& event : buildings) {
+        if (GameCity* city = world.cities.get(event.city)) {
+            city->addBuilding(event.building);
+        }
+    }
+}
+
+void CityManager::updateSpawning(float deltaTime) {
     // City spawning mechanics (optional)
     citySpawnCooldown += deltaTime;
     if (citySpawnCooldown >= citySpawnInterval) {
@@ -105,12 +181,6 @@ void CityManager::update(float deltaTime) {
     }
 }
 
-void CityManager::draw(sf::RenderWindow& window) {
-    for (auto& city : cities) {
-        city.draw(window);
-    }
-}
-
 std::string CityManager::getNextCityName() {
     if (cityNames.empty()) {
         return "City " + std::to_string(nameIndex++);
@@ -124,39 +194,34 @@ std::string CityManager::getNextCityName() {
 }
 
 bool CityManager::isCityAt(const sf::Vector2f& position) const {
-    for (const auto& city : cities) {
-        if (city.contains(position)) {
-            return true;
-        }
-    }
-    return false;
+    return world.pickAt(world.cities, position).isValid();
 }
 
 void CityManager::trySpawnRandomCity() {
     // Only spawn if below max cities
-    if (cities.size() >= maxCities) return;
-    
-    // Random number generator
-    std::random_device rd;
-    std::mt19937 gen(rd());
+    if (maxCities > 0 && getCityCount() >= maxCities) return;
     
     // Assume a reasonable map size (adjust based on your game's map)
     std::uniform_real_distribution<> xDist(100.0f, 3000.0f);
     std::uniform_real_distribution<> yDist(100.0f, 2000.0f);
     
     // Try to spawn a city at a random location
-    sf::Vector2f potentialPosition(xDist(gen), yDist(gen));
+    sf::Vector2f potentialPosition(xDist(rng), yDist(rng));
     
     // This will check for minimum distance and max cities
     addCity(potentialPosition);
 }
 
 std::vector<GameCity>& CityManager::getCities() {
-    return cities;
+    return world.cities.data();
 }
 
 const std::vector<GameCity>& CityManager::getCities() const {
-    return cities;
+    return world.cities.data();
+}
+
+const std::vector<Entity>& CityManager::getCityEntities() const {
+    return world.cities.entities();
 }
 
 } // namespace game
\ No newline at end of file
@@ -2,56 +2,93 @@
 #define CITY_MANAGER_HPP
 
 #include "City.hpp"
+#include "Ecs.hpp"
+#include "TurnEvents.hpp"
+#include <SFML/System/Vector2.hpp>
+#include <cstddef>
 #include <vector>
 #include <string>
 #include <random>
 
+class World;
+class ThreadPool;
+class TileYieldCache;
+
 namespace game {
 
+// Facade over the city entities in the World
 class CityManager {
 private:
-    std::vector<GameCity> cities;
-    GameCity* selectedCity;
+    World& world;
+    Entity selectedCity;
     
     // City name generator
     std::vector<std::string> cityNames;
     int nameIndex;
     
-    // City spawn mechanics
-    int maxCities;
+    // City spawn mechanics; 0 means no cap
+    size_t maxCities;
     float citySpawnCooldown;
     float citySpawnInterval;
     
+    // Seeded so headless runs are reproducible
+    std::mt19937 rng;
+    
+    // Per-thread results of the parallel turn, merged in city order afterwards
+    struct IndexedCompletion {
+        size_t cityIndex;
+        GameCity::ProductionItem item;
+    };
+    std::vector<std::vector<IndexedCompletion>> threadCompletions;
+    std::vector<IndexedCompletion> mergedCompletions;
+    
     void initializeCityNames();
     void trySpawnRandomCity();
     
 public:
-    CityManager();
+    explicit CityManager(World& world);
     
-    // City management
-    void addCity(const sf::Vector2f& position);
-    void removeCity(size_t index);
+    // Reseed the generator used for random city spawns
+    void setSeed(unsigned int seed) { rng.seed(seed); }
+    
+    // Cap on the number of cities; 0 removes the cap
+    void setMaxCities(size_t count) { maxCities = count; }
+    size_t getMaxCities() const { return maxCities; }
+    
+    // City management; addCity returns an invalid entity if the city was refused
+    Entity addCity(const sf::Vector2f& position);
+    void removeCity(Entity city);
     
     // City access
-    size_t getCityCount() const { return cities.size(); }
-    GameCity* getCityAt(size_t index);
+    size_t getCityCount() const;
+    GameCity* getCity(Entity city);
+    const sf::Vector2f* getCityPosition(Entity city) const;
     
     // Selection
     bool selectCityAt(const sf::Vector2f& position);
     void deselectCity();
-    GameCity* getSelectedCity() { return selectedCity; }
+    GameCity* getSelectedCity() { return getCity(selectedCity); }
+    Entity getSelectedCityEntity() const { return selectedCity; }
+    
+    // Turn stages, run in this order and spread across the pool's threads.
+    // The outcome does not depend on the thread count.
+    // Finished items are appended to events in city order.
+    void applyWorkedYields(const TileYieldCache& yields, ThreadPool& pool);
+    void processProduction(ThreadPool& pool, TurnEvents& events);
+    void processGrowth(ThreadPool& pool);
+    void updateSpawning(float deltaTime);
     
-    // Update and render
-    void update(float deltaTime);
-    void draw(sf::RenderWindow& window);
+    // Apply a turn's finished buildings to their cities
+    void addBuildings(const std::vector<BuildingAddedEvent>& buildings);
     
     // Utility
     std::string getNextCityName();
     bool isCityAt(const sf::Vector2f& position) const;
     
-    // City list access
+    // Dense city list access; getCityEntities()[i] owns getCities()[i]
     std::vector<GameCity>& getCities();
     const std::vector<GameCity>& getCities() const;
+    const std::vector<Entity>& getCityEntities() const;
 };
 
 } // namespace game
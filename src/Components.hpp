@@ -0,0 +1,75 @@
+#pragma once
+
+#include "GameEntities.hpp"
+#include <SFML/System/Vector2.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Plain-data components shared by units, the hero, cities and merchants.
+// Bigger per-kind state (Hero, Army, game::GameCity, NPCMerchant) is stored
+// as its own component type in World.
+
+// World position; previous is the position one tick earlier, for interpolation
+struct Position {
+    sf::Vector2f current;
+    sf::Vector2f previous;
+
+    Position() = default;
+    explicit Position(const sf::Vector2f& pos) : current(pos), previous(pos) {}
+};
+
+// Anything that can walk a path
+struct Movement {
+    float speed = 300.0f;
+    int movementPoints = 100;  // Total movement points
+};
+
+// Waypoints being followed; only present while the entity is moving.
+// The waypoints themselves live in the World's PathPool; go through it to
+// set, read or drop them.
+struct MovementPath {
+    static constexpr std::uint32_t NO_BLOCK = 0xffffffffu;
+
+    std::uint32_t head = NO_BLOCK;    // First block of the chain
+    std::uint32_t cursor = NO_BLOCK;  // Block holding the waypoint being approached
+    std::uint32_t count = 0;          // Waypoints in the path
+    std::uint32_t next = 0;           // Index of the waypoint being approached
+};
+
+// Map units that can be ordered around (settlers, warriors, builders)
+struct Unit {
+    UnitType type = UnitType::Settler;
+
+    Unit() = default;
+    explicit Unit(UnitType unitType) : type(unitType) {}
+};
+
+// Side an entity plays for; entities without one belong to the player
+struct Faction {
+    static constexpr std::uint8_t PLAYER = 0;
+
+    std::uint8_t id = PLAYER;
+
+    Faction() = default;
+    explicit Faction(std::uint8_t factionId) : id(factionId) {}
+};
+
+// Click target around the entity's position
+struct Selectable {
+    float radius = 15.0f;
+    bool square = false;    // Box of half-size radius instead of a circle
+    bool selected = false;
+
+    Selectable() = default;
+    Selectable(float pickRadius, bool pickSquare) : radius(pickRadius), square(pickSquare) {}
+
+    bool contains(const sf::Vector2f& center, const sf::Vector2f& point) const {
+        float dx = point.x - center.x;
+        float dy = point.y - center.y;
+        if (square) {
+            return dx >= -radius && dx <= radius && dy >= -radius && dy <= radius;
+        }
+        return dx * dx + dy * dy <= radius * radius;
+    }
+};
@@ -0,0 +1,364 @@
+#include "Definitions.hpp"
+#include "Log.hpp"
+#include <cstdlib>
+#include <fstream>
+
+namespace Definitions {
+    std::array<TerrainDefinition, TERRAIN_COUNT> terrainTable = BUILTIN_TERRAIN;
+}
+
+namespace {
+    using namespace Definitions;
+
+    struct Tables {
+        std::vector<UnitDefinition> units;
+        std::vector<ItemDefinition> items;
+        std::vector<SkillDefinition> skills;
+        std::vector<std::size_t> merchantUnits;
+        std::vector<std::size_t> merchantItems;
+        std::vector<std::size_t> startingArmy;
+        std::vector<std::size_t> startingItems;
+        std::vector<std::size_t> startingSkills;
+    };
+
+    void fillBuiltins(Tables& tables) {
+        tables.units = {
+            {"Footman", ArmyUnitType::Infantry, 100, 10, 8, 50},
+            {"Archer", ArmyUnitType::Archer, 80, 15, 5, 70},
+        };
+        tables.items = {
+            {"Health Potion", "Restores 50 health", 25},
+            {"Mana Potion", "Restores 30 mana", 30},
+            {"Bronze Sword", "A basic sword", 50},
+            {"Leather Armor", "Basic armor", 75},
+        };
+        tables.skills = {
+            {"Strength", "Increases physical damage", 1, 5},
+            {"Defense", "Reduces damage taken", 1, 5},
+            {"Leadership", "Improves army performance", 1, 5},
+        };
+        tables.merchantUnits = {0, 1};
+        tables.merchantItems = {0, 1};
+        tables.startingArmy = {0, 1};
+        tables.startingItems = {2, 3, 0};
+        tables.startingSkills = {0, 1, 2};
+    }
+
+    // Built on first use, so heroes and merchants made during static init see the defaults
+    Tables& getTables() {
+        static Tables tables = [] {
+            Tables built;
+            fillBuiltins(built);
+            return built;
+        }();
+        return tables;
+    }
+
+    // Whitespace-separated tokens; double quotes group spaces into one token
+    // and are dropped, so description="Basic armor" reads as description=Basic armor
+    std::vector<std::string> tokenize(const std::string& line) {
+        std::vector<std::string> tokens;
+        std::string current;
+        bool quoted = false;
+        bool inToken = false;
+        for (char c : line) {
+            if (c == '"') {
+                quoted = !quoted;
+                inToken = true;
+            } else if (!quoted && (c == ' ' || c == '\t' || c == '\r')) {
+                if (inToken) tokens.push_back(current);
+                current.clear();
+                inToken = false;
+            } else if (!quoted && c == '#') {
+                break;
+            } else {
+                current += c;
+                inToken = true;
+            }
+        }
+        if (inToken) tokens.push_back(current);
+        return tokens;
+    }
+
+    bool parseInt(const std::string& text, int& out) {
+        if (text.empty()) return false;
+        char* end = nullptr;
+        long value = std::strtol(text.c_str(), &end, 10);
+        if (*end != '\0') return false;
+        out = static_cast<int>(value);
+        return true;
+    }
+
+    bool parseFloat(const std::string& text, float& out) {
+        if (text.empty()) return false;
+        char* end = nullptr;
+        float value = std::strtof(text.c_str(), &end);
+        if (*end != '\0') return false;
+        out = value;
+        return true;
+    }
+
+    bool parseBool(const std::string& text, bool& out) {
+        if (text == "yes" || text == "true") { out = true; return true; }
+        if (text == "no" || text == "false") { out = false; return true; }
+        return false;
+    }
+
+    // rrggbb or rrggbbaa
+    bool parseColor(const std::string& text, Rgba& out) {
+        if (text.size() != 6 && text.size() != 8) return false;
+        char* end = nullptr;
+        unsigned long value = std::strtoul(text.c_str(), &end, 16);
+        if (*end != '\0') return false;
+        if (text.size() == 6) value = (value << 8) | 0xff;
+        out = Rgba{static_cast<std::uint8_t>(value >> 24), static_cast<std::uint8_t>(value >> 16),
+                   static_cast<std::uint8_t>(value >> 8), static_cast<std::uint8_t>(value)};
+        return true;
+    }
+
+    bool parseResourceType(const std::string& text, ResourceType& out) {
+        if (text == "Food") out = ResourceType::Food;
+        else if (text == "Wood") out = ResourceType::Wood;
+        else if (text == "Stone") out = ResourceType::Stone;
+        else if (text == "Gold") out = ResourceType::Gold;
+        else return false;
+        return true;
+    }
+
+    bool parseUnitType(const std::string& text, ArmyUnitType& out) {
+        if (text == "Infantry") out = ArmyUnitType::Infantry;
+        else if (text == "Archer") out = ArmyUnitType::Archer;
+        else if (text == "Cavalry") out = ArmyUnitType::Cavalry;
+        else if (text == "Mage") out = ArmyUnitType::Mage;
+        else return false;
+        return true;
+    }
+
+    // Index of the entry with that name, appending a blank one if there is none
+    template <typename Definition>
+    std::size_t findOrAdd(std::vector<Definition>& table, const std::string& name) {
+        InternedString interned(name);
+        for (std::size_t i = 0; i < table.size(); ++i) {
+            if (table[i].name == interned) return i;
+        }
+        table.push_back(Definition{});
+        table.back().name = interned;
+        return table.size() - 1;
+    }
+
+    template <typename Definition>
+    bool find(const std::vector<Definition>& table, const std::string& name, std::size_t& index) {
+        InternedString interned(name);
+        for (std::size_t i = 0; i < table.size(); ++i) {
+            if (table[i].name == interned) {
+                index = i;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    class Loader {
+    private:
+        Tables& tables;
+        const std::string& path;
+        int lineNumber;
+        bool failed;
+
+        void report(const std::string& message) {
+            LOG_ERROR("definitions", "{}:{}: {}", path, lineNumber, message);
+            failed = true;
+        }
+
+        // Splits key=value; reports and returns false for anything else
+        bool splitField(const std::string& token, std::string& key, std::string& value) {
+            std::size_t equals = token.find('=');
+            if (equals == std::string::npos) {
+                report("expected key=value, got '" + token + "'");
+                return false;
+            }
+            key = token.substr(0, equals);
+            value = token.substr(equals + 1);
+            return true;
+        }
+
+        void badValue(const std::string& key, const std::string& value) {
+            report("bad value '" + value + "' for " + key);
+        }
+
+        void parseTerrain(const std::vector<std::string>& tokens) {
+            TerrainDefinition* definition = nullptr;
+            for (TerrainDefinition& candidate : terrainTable) {
+                if (candidate.name == tokens[1]) definition = &candidate;
+            }
+            if (!definition) {
+                report("unknown terrain '" + tokens[1] + "'");
+                return;
+            }
+
+            std::string key, value;
+            for (std::size_t i = 2; i < tokens.size(); ++i) {
+                if (!splitField(tokens[i], key, value)) continue;
+                bool ok = true;
+                if (key == "move") ok = parseFloat(value, definition->stats.movementCost);
+                else if (key == "food") ok = parseInt(value, definition->stats.food);
+                else if (key == "production") ok = parseInt(value, definition->stats.production);
+                else if (key == "gold") ok = parseInt(value, definition->stats.gold);
+                else if (key == "defense") ok = parseInt(value, definition->stats.defense);
+                else if (key == "walkable") ok = parseBool(value, definition->walkable);
+                else if (key == "weight") ok = parseInt(value, definition->mapWeight) && definition->mapWeight >= 0;
+                else if (key == "color") ok = parseColor(value, definition->color);
+                else if (key == "shadow") ok = parseColor(value, definition->shadowColor);
+                else if (key == "resource") {
+                    // Type:quantity, as in Wood:2
+                    std::size_t colon = value.find(':');
+                    ok = colon != std::string::npos &&
+                         parseResourceType(value.substr(0, colon), definition->baseProduction.type) &&
+                         parseInt(value.substr(colon + 1), definition->baseProduction.quantity);
+                } else {
+                    report("unknown terrain field '" + key + "'");
+                    continue;
+                }
+                if (!ok) badValue(key, value);
+            }
+
+            definition->pathCost = definition->walkable ? definition->stats.movementCost
+                                                        : std::numeric_limits<float>::max();
+        }
+
+        void parseUnit(const std::vector<std::string>& tokens) {
+            UnitDefinition& definition = tables.units[findOrAdd(tables.units, tokens[1])];
+            std::string key, value;
+            for (std::size_t i = 2; i < tokens.size(); ++i) {
+                if (!splitField(tokens[i], key, value)) continue;
+                bool ok = true;
+                if (key == "type") ok = parseUnitType(value, definition.type);
+                else if (key == "health") ok = parseInt(value, definition.health);
+                else if (key == "attack") ok = parseInt(value, definition.attack);
+                else if (key == "defense") ok = parseInt(value, definition.defense);
+                else if (key == "cost") ok = parseInt(value, definition.cost);
+                else {
+                    report("unknown unit field '" + key + "'");
+                    continue;
+                }
+                if (!ok) badValue(key, value);
+            }
+        }
+
+        void parseItem(const std::vector<std::string>& tokens) {
+            ItemDefinition& definition = tables.items[findOrAdd(tables.items, tokens[1])];
+            std::string key, value;
+            for (std::size_t i = 2; i < tokens.size(); ++i) {
+                if (!splitField(tokens[i], key, value)) continue;
+                bool ok = true;
+                if (key == "description") definition.description = value;
+                else if (key == "value") ok = parseInt(value, definition.value);
+                else {
+                    report("unknown item field '" + key + "'");
+                    continue;
+                }
+                if (!ok) badValue(key, value);
+            }
+        }
+
+        void parseSkill(const std::vector<std::string>& tokens) {
+            std::size_t index = findOrAdd(tables.skills, tokens[1]);
+            SkillDefinition& definition = tables.skills[index];
+            if (definition.maxLevel == 0) {
+                definition.level = 1;
+                definition.maxLevel = 5;
+            }
+
+            std::string key, value;
+            for (std::size_t i = 2; i < tokens.size(); ++i) {
+                if (!splitField(tokens[i], key, value)) continue;
+                bool ok = true;
+                if (key == "description") definition.description = value;
+                else if (key == "level") ok = parseInt(value, definition.level);
+                else if (key == "max") ok = parseInt(value, definition.maxLevel);
+                else {
+                    report("unknown skill field '" + key + "'");
+                    continue;
+                }
+                if (!ok) badValue(key, value);
+            }
+        }
+
+        // A list line replaces the whole list with the named entries
+        template <typename Definition>
+        void parseList(const std::vector<std::string>& tokens, const std::vector<Definition>& table,
+                       std::vector<std::size_t>& list) {
+            list.clear();
+            for (std::size_t i = 1; i < tokens.size(); ++i) {
+                std::size_t index = 0;
+                if (find(table, tokens[i], index)) {
+                    list.push_back(index);
+                } else {
+                    report(tokens[0] + " names unknown entry '" + tokens[i] + "'");
+                }
+            }
+        }
+
+    public:
+        Loader(Tables& loadedTables, const std::string& filePath)
+            : tables(loadedTables), path(filePath), lineNumber(0), failed(false) {}
+
+        bool parse(std::istream& in) {
+            std::string line;
+            while (std::getline(in, line)) {
+                ++lineNumber;
+                std::vector<std::string> tokens = tokenize(line);
+                if (tokens.empty()) continue;
+
+                const std::string& record = tokens[0];
+                bool named = record == "terrain" || record == "unit" || record == "item" || record == "skill";
+                if (named && tokens.size() < 2) {
+                    report(record + " needs a name");
+                    continue;
+                }
+
+                if (record == "terrain") parseTerrain(tokens);
+                else if (record == "unit") parseUnit(tokens);
+                else if (record == "item") parseItem(tokens);
+                else if (record == "skill") parseSkill(tokens);
+                else if (record == "merchant-units") parseList(tokens, tables.units, tables.merchantUnits);
+                else if (record == "merchant-items") parseList(tokens, tables.items, tables.merchantItems);
+                else if (record == "starting-army") parseList(tokens, tables.units, tables.startingArmy);
+                else if (record == "starting-items") parseList(tokens, tables.items, tables.startingItems);
+                else if (record == "starting-skills") parseList(tokens, tables.skills, tables.startingSkills);
+                else report("unknown record '" + record + "'");
+            }
+            return !failed;
+        }
+    };
+}
+
+namespace Definitions {
+    const UnitDefinition& getUnit(std::size_t index) { return getTables().units[index]; }
+    const ItemDefinition& getItem(std::size_t index) { return getTables().items[index]; }
+    const SkillDefinition& getSkill(std::size_t index) { return getTables().skills[index]; }
+    std::size_t getUnitCount() { return getTables().units.size(); }
+    std::size_t getItemCount() { return getTables().items.size(); }
+    std::size_t getSkillCount() { return getTables().skills.size(); }
+
+    const std::vector<std::size_t>& getMerchantUnits() { return getTables().merchantUnits; }
+    const std::vector<std::size_t>& getMerchantItems() { return getTables().merchantItems; }
+    const std::vector<std::size_t>& getStartingArmy() { return getTables().startingArmy; }
+    const std::vector<std::size_t>& getStartingItems() { return getTables().startingItems; }
+    const std::vector<std::size_t>& getStartingSkills() { return getTables().startingSkills; }
+
+    void resetToBuiltins() {
+        terrainTable = BUILTIN_TERRAIN;
+        fillBuiltins(getTables());
+    }
+
+    bool load(const std::string& path) {
+        std::ifstream file(path);
+        if (!file) {
+            LOG_ERROR("definitions", "Could not open definitions file {}", path);
+            return false;
+        }
+
+        return Loader(getTables(), path).parse(file);
+    }
+}
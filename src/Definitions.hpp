@@ -0,0 +1,123 @@
+#pragma once
+
+#include "Army.hpp"
+#include "GameEntities.hpp"
+#include "InternedString.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Game content tables: terrain, army units, items and skills.
+// Everything starts out as the built-in defaults below and can be
+// overridden or extended from a definitions file at startup, so new units
+// and items need no recompile. Terrain is indexed by TileType, so looking
+// a tile's properties up is one array load; units, items and skills are
+// addressed by their index in load order.
+namespace Definitions {
+    struct Rgba {
+        std::uint8_t r, g, b, a;
+    };
+
+    struct TerrainDefinition {
+        TileType type;
+        std::string_view name;      // Also the terrain's key in definitions files
+        TileStats stats;
+        bool walkable;
+        float pathCost;             // stats.movementCost, or infinity where units cannot walk
+        game::Resource baseProduction;
+        int mapWeight;              // Share of generated tiles, out of all terrain weights
+        Rgba color;
+        Rgba shadowColor;           // 2.5D drop shadow
+    };
+
+    struct UnitDefinition {
+        InternedString name;
+        ArmyUnitType type;
+        int health;
+        int attack;
+        int defense;
+        int cost;
+    };
+
+    struct ItemDefinition {
+        InternedString name;
+        InternedString description;
+        int value;
+    };
+
+    struct SkillDefinition {
+        InternedString name;
+        InternedString description;
+        int level;
+        int maxLevel;
+    };
+
+    constexpr std::size_t TERRAIN_COUNT = 5;
+
+    constexpr TerrainDefinition makeTerrain(TileType type, std::string_view name,
+                                            float movementCost, int food, int production, int gold,
+                                            bool walkable, ResourceType resource, int quantity,
+                                            int mapWeight, Rgba color, Rgba shadowColor) {
+        return TerrainDefinition{
+            type, name, TileStats{movementCost, 0, food, production, gold}, walkable,
+            walkable ? movementCost : std::numeric_limits<float>::max(),
+            game::Resource{resource, quantity}, mapWeight, color, shadowColor
+        };
+    }
+
+    // In TileType order
+    constexpr std::array<TerrainDefinition, TERRAIN_COUNT> BUILTIN_TERRAIN = {{
+        makeTerrain(TileType::Plains, "Plains", 1.0f, 2, 1, 0, true, ResourceType::Food, 2, 60,
+                    {154, 205, 50, 255}, {92, 123, 30, 120}),
+        makeTerrain(TileType::Hills, "Hills", 2.0f, 0, 2, 1, true, ResourceType::Stone, 1, 10,
+                    {160, 82, 45, 255}, {96, 49, 27, 120}),
+        makeTerrain(TileType::Mountain, "Mountain", 4.0f, 0, 1, 0, false, ResourceType::Stone, 1, 5,
+                    {105, 105, 105, 255}, {60, 60, 60, 120}),
+        makeTerrain(TileType::Forest, "Forest", 1.5f, 1, 2, 0, true, ResourceType::Wood, 2, 15,
+                    {85, 107, 47, 255}, {50, 64, 28, 120}),
+        makeTerrain(TileType::Water, "Water", 3.0f, 2, 0, 1, false, ResourceType::Food, 1, 10,
+                    {30, 144, 255, 255}, {15, 72, 127, 120}),
+    }};
+
+    constexpr bool isIndexedByType(const std::array<TerrainDefinition, TERRAIN_COUNT>& table) {
+        for (std::size_t i = 0; i < table.size(); ++i) {
+            if (static_cast<std::size_t>(table[i].type) != i) return false;
+        }
+        return true;
+    }
+    static_assert(isIndexedByType(BUILTIN_TERRAIN), "BUILTIN_TERRAIN must follow TileType order");
+
+    // Live terrain table; use getTerrain
+    extern std::array<TerrainDefinition, TERRAIN_COUNT> terrainTable;
+
+    inline const TerrainDefinition& getTerrain(TileType type) {
+        return terrainTable[static_cast<std::size_t>(type)];
+    }
+
+    // Only valid for indices below the matching count
+    const UnitDefinition& getUnit(std::size_t index);
+    const ItemDefinition& getItem(std::size_t index);
+    const SkillDefinition& getSkill(std::size_t index);
+    std::size_t getUnitCount();
+    std::size_t getItemCount();
+    std::size_t getSkillCount();
+
+    // Index lists into the tables above
+    const std::vector<std::size_t>& getMerchantUnits();
+    const std::vector<std::size_t>& getMerchantItems();
+    const std::vector<std::size_t>& getStartingArmy();
+    const std::vector<std::size_t>& getStartingItems();
+    const std::vector<std::size_t>& getStartingSkills();
+
+    // Put every table back to the built-in defaults
+    void resetToBuiltins();
+
+    // Apply a definitions file on top of the current tables. Bad lines are
+    // reported on stderr and skipped; false if the file could not be read
+    // or had errors.
+    bool load(const std::string& path);
+}
@@ -0,0 +1,88 @@
+#include "DrawTarget.hpp"
+
+DrawTally DrawStats::total() const {
+    DrawTally sum;
+    for (const auto& tally : categories) {
+        sum += tally;
+    }
+    return sum;
+}
+
+const char* DrawStats::getCategoryName(DrawCategory category) {
+    switch (category) {
+        case DrawCategory::Terrain: return "terrain";
+        case DrawCategory::Borders: return "borders";
+        case DrawCategory::Entities: return "entities";
+        case DrawCategory::UI: return "ui";
+        case DrawCategory::Overlay: return "overlay";
+        default: return "?";
+    }
+}
+
+DrawTarget::DrawTarget(sf::RenderTarget& renderTarget)
+    : target(renderTarget), category(DrawCategory::UI), lastTexture(nullptr),
+      scratch(std::pmr::get_default_resource()) {
+}
+
+DrawCategory DrawTarget::setCategory(DrawCategory drawCategory) {
+    DrawCategory previous = category;
+    category = drawCategory;
+    return previous;
+}
+
+void DrawTarget::beginFrame() {
+    lastFrame = frame;
+    frame.clear();
+}
+
+void DrawTarget::count(std::size_t drawCalls, std::size_t vertices, const void* texture) {
+    DrawTally& tally = frame[category];
+    tally.drawCalls += drawCalls;
+    tally.vertices += vertices;
+    if (texture && texture != lastTexture) {
+        ++tally.textureBinds;
+    }
+    lastTexture = texture;
+}
+
+void DrawTarget::draw(const sf::Shape& shape, const sf::RenderStates& states) {
+    // Fill is a triangle fan around the center, the outline a strip
+    std::size_t points = shape.getPointCount();
+    std::size_t drawCalls = 1;
+    std::size_t vertices = points + 2;
+    if (shape.getOutlineThickness() != 0.0f) {
+        ++drawCalls;
+        vertices += (points + 1) * 2;
+    }
+    count(drawCalls, vertices, shape.getTexture());
+    target.draw(shape, states);
+}
+
+void DrawTarget::draw(const sf::Text& text, const sf::RenderStates& states) {
+    // Two triangles per glyph, again for the outline; the glyphs come from
+    // the font's texture
+    std::size_t vertices = text.getString().getSize() * 6;
+    std::size_t drawCalls = 1;
+    if (text.getOutlineThickness() != 0.0f) {
+        ++drawCalls;
+        vertices *= 2;
+    }
+    ++frame[category].texts;
+    count(drawCalls, vertices, &text.getFont());
+    target.draw(text, states);
+}
+
+void DrawTarget::draw(const sf::Sprite& sprite, const sf::RenderStates& states) {
+    count(1, 4, &sprite.getTexture());
+    target.draw(sprite, states);
+}
+
+void DrawTarget::draw(const sf::VertexArray& vertices, const sf::RenderStates& states) {
+    count(1, vertices.getVertexCount(), states.texture);
+    target.draw(vertices, states);
+}
+
+void DrawTarget::draw(const sf::Drawable& drawable, const sf::RenderStates& states) {
+    count(1, 0, states.texture);
+    target.draw(drawable, states);
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+
+// What a frame submitted, per category of drawing
+enum class DrawCategory {
+    Terrain,
+    Borders,
+    Entities,
+    UI,
+    Overlay,
+    Count
+};
+
+struct DrawTally {
+    std::size_t drawCalls = 0;
+    std::size_t vertices = 0;
+    std::size_t textureBinds = 0;  // Draws that switched to a different texture
+    std::size_t texts = 0;
+
+    DrawTally& operator+=(const DrawTally& other) {
+        drawCalls += other.drawCalls;
+        vertices += other.vertices;
+        textureBinds += other.textureBinds;
+        texts += other.texts;
+        return *this;
+    }
+};
+
+struct DrawStats {
+    std::array<DrawTally, static_cast<std::size_t>(DrawCategory::Count)> categories;
+
+    DrawTally& operator[](DrawCategory category) { return categories[static_cast<std::size_t>(category)]; }
+    const DrawTally& operator[](DrawCategory category) const { return categories[static_cast<std::size_t>(category)]; }
+
+    DrawTally total() const;
+    void clear() { categories.fill(DrawTally{}); }
+
+    static const char* getCategoryName(DrawCategory category);
+};
+
+// All drawing goes through here instead of straight to the window.
+// Forwards to the wrapped render target and tallies draw calls, vertices,
+// texture switches and text objects under the current category, the way
+// SFML submits them: a shape with an outline is two draw calls, a text is
+// six vertices per glyph, and so on.
+// Also carries the frame's scratch memory, so drawing code can build
+// transient lists and strings without going to the global allocator.
+class DrawTarget {
+private:
+    sf::RenderTarget& target;
+    DrawCategory category;
+    DrawStats frame;
+    DrawStats lastFrame;
+    const void* lastTexture;
+    std::pmr::memory_resource* scratch;
+
+    void count(std::size_t drawCalls, std::size_t vertices, const void* texture);
+
+public:
+    explicit DrawTarget(sf::RenderTarget& renderTarget);
+
+    // Tally what follows under category; returns the category it replaces
+    DrawCategory setCategory(DrawCategory drawCategory);
+    DrawCategory getCategory() const { return category; }
+
+    // Close the current frame's tallies and start the next one
+    void beginFrame();
+
+    const DrawStats& getFrameStats() const { return frame; }
+    const DrawStats& getLastFrameStats() const { return lastFrame; }
+
+    // Memory for data that dies with the frame, normally the frame arena;
+    // the global allocator until one is set
+    void setScratch(std::pmr::memory_resource& memory) { scratch = &memory; }
+    std::pmr::memory_resource* getScratch() const { return scratch; }
+
+    void draw(const sf::Shape& shape, const sf::RenderStates& states = sf::RenderStates::Default);
+    void draw(const sf::Text& text, const sf::RenderStates& states = sf::RenderStates::Default);
+    void draw(const sf::Sprite& sprite, const sf::RenderStates& states = sf::RenderStates::Default);
+    void draw(const sf::VertexArray& vertices, const sf::RenderStates& states = sf::RenderStates::Default);
+
+    // Anything else counts as one draw call of unknown size
+    void draw(const sf::Drawable& drawable, const sf::RenderStates& states = sf::RenderStates::Default);
+
+    // Pass-throughs for code that positions itself from the target
+    sf::Vector2u getSize() const { return target.getSize(); }
+    const sf::View& getView() const { return target.getView(); }
+    void setView(const sf::View& view) { target.setView(view); }
+
+    sf::RenderTarget& getTarget() { return target; }
+};
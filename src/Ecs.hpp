@@ -0,0 +1,112 @@
+#pragma once
+
+#include "SlotMap.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// Minimal sparse-set entity-component core.
+// Entities are plain ids; components live in dense arrays per type so systems
+// walk contiguous memory instead of chasing pointers through entity objects.
+
+// Entity id: a generational slot-map handle, so a stale id never aliases
+// a newer entity that reused the same slot
+using Entity = Handle;
+
+// Hands out entity ids and recycles freed slots.
+// A slot map without payload; the components live in ComponentPools.
+class EntityRegistry {
+private:
+    struct Record {};
+    SlotMap<Record> records;
+
+public:
+    Entity create() { return records.insert(); }
+    void destroy(Entity entity) { records.erase(entity); }
+    bool isAlive(Entity entity) const { return records.contains(entity); }
+
+    std::size_t size() const { return records.size(); }
+
+    // Every live entity, in dense order
+    const std::vector<Entity>& entities() const { return records.handles(); }
+};
+
+// Sparse set of one component type.
+// sparse maps entity index -> dense slot; dense arrays hold owners and
+// components side by side. Removal swaps the last element into the hole,
+// so the dense arrays never have gaps.
+template <typename T>
+class ComponentPool {
+private:
+    static constexpr std::uint32_t EMPTY = 0xFFFFFFFFu;
+
+    std::vector<std::uint32_t> sparse;
+    std::vector<Entity> owners;
+    std::vector<T> components;
+
+public:
+    bool has(Entity entity) const {
+        return entity.index < sparse.size() &&
+               sparse[entity.index] != EMPTY &&
+               owners[sparse[entity.index]] == entity;
+    }
+
+    T* get(Entity entity) {
+        return has(entity) ? &components[sparse[entity.index]] : nullptr;
+    }
+
+    const T* get(Entity entity) const {
+        return has(entity) ? &components[sparse[entity.index]] : nullptr;
+    }
+
+    // Add or replace the component of an entity
+    template <typename... Args>
+    T& add(Entity entity, Args&&... args) {
+        if (has(entity)) {
+            T& existing = components[sparse[entity.index]];
+            existing = T(std::forward<Args>(args)...);
+            return existing;
+        }
+
+        if (entity.index >= sparse.size()) {
+            sparse.resize(entity.index + 1, EMPTY);
+        }
+        sparse[entity.index] = static_cast<std::uint32_t>(owners.size());
+        owners.push_back(entity);
+        components.emplace_back(std::forward<Args>(args)...);
+        return components.back();
+    }
+
+    // Swap-remove; returns false if the entity had no such component
+    bool remove(Entity entity) {
+        if (!has(entity)) return false;
+
+        std::uint32_t slot = sparse[entity.index];
+        std::uint32_t last = static_cast<std::uint32_t>(owners.size() - 1);
+        if (slot != last) {
+            owners[slot] = owners[last];
+            components[slot] = std::move(components[last]);
+            sparse[owners[slot].index] = slot;
+        }
+        owners.pop_back();
+        components.pop_back();
+        sparse[entity.index] = EMPTY;
+        return true;
+    }
+
+    void clear() {
+        sparse.clear();
+        owners.clear();
+        components.clear();
+    }
+
+    std::size_t size() const { return components.size(); }
+    bool empty() const { return components.empty(); }
+
+    // Dense access for systems
+    std::vector<T>& data() { return components; }
+    const std::vector<T>& data() const { return components; }
+    const std::vector<Entity>& entities() const { return owners; }
+    Entity entityAt(std::size_t slot) const { return owners[slot]; }
+};
@@ -0,0 +1,33 @@
+#include "FixedTimestep.hpp"
+#include <algorithm>
+
+FixedTimestep::FixedTimestep(float ticksPerSecond, int maxTicks)
+    : tickDuration(1.0f / ticksPerSecond),
+      accumulator(0.0f),
+      maxTicksPerAdvance(maxTicks)
+{
+}
+
+void FixedTimestep::setTickRate(float ticksPerSecond) {
+    if (ticksPerSecond > 0.0f) {
+        tickDuration = 1.0f / ticksPerSecond;
+        accumulator = std::min(accumulator, tickDuration);
+    }
+}
+
+int FixedTimestep::advance(float elapsedSeconds) {
+    accumulator += std::max(0.0f, elapsedSeconds);
+
+    int ticks = 0;
+    while (accumulator >= tickDuration && ticks < maxTicksPerAdvance) {
+        accumulator -= tickDuration;
+        ++ticks;
+    }
+
+    // Drop the backlog we refused to simulate
+    if (ticks == maxTicksPerAdvance && accumulator >= tickDuration) {
+        accumulator = 0.0f;
+    }
+
+    return ticks;
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+// Accumulator-based fixed timestep.
+// Real elapsed time is fed in, whole ticks of a fixed length come out, and
+// the leftover fraction is exposed for interpolating rendered positions.
+class FixedTimestep {
+private:
+    float tickDuration;
+    float accumulator;
+    int maxTicksPerAdvance;
+
+public:
+    explicit FixedTimestep(float ticksPerSecond = 60.0f, int maxTicks = 8);
+
+    void setTickRate(float ticksPerSecond);
+    float getTickRate() const { return 1.0f / tickDuration; }
+    float getTickDuration() const { return tickDuration; }
+
+    // Add elapsed real time and return how many ticks are due.
+    // Capped at maxTicksPerAdvance so a long stall cannot snowball;
+    // time beyond the cap is dropped.
+    int advance(float elapsedSeconds);
+
+    // Fraction of the next tick already accumulated, in [0, 1)
+    float getAlpha() const { return accumulator / tickDuration; }
+
+    // Real time left until the next tick is due
+    float getTimeUntilNextTick() const { return tickDuration - accumulator; }
+
+    void reset() { accumulator = 0.0f; }
+};
@@ -0,0 +1,73 @@
+#include "FrameArena.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <new>
+
+FrameArena::FrameArena(std::size_t initialBytes)
+    : frameAllocations(0), peakBytes(0) {
+    addBlock(std::max<std::size_t>(initialBytes, 64));
+}
+
+FrameArena::~FrameArena() {
+    for (const Block& block : blocks) {
+        ::operator delete(block.memory);
+    }
+}
+
+void FrameArena::addBlock(std::size_t size) {
+    Block block;
+    block.memory = static_cast<std::byte*>(::operator new(size));
+    block.size = size;
+    block.offset = 0;
+    blocks.push_back(block);
+}
+
+void* FrameArena::do_allocate(std::size_t bytes, std::size_t alignment) {
+    Block* block = &blocks.back();
+    std::uintptr_t base = reinterpret_cast<std::uintptr_t>(block->memory);
+    std::uintptr_t aligned = (base + block->offset + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+
+    if (aligned - base + bytes > block->size) {
+        // Room for the request at any alignment; the next reset folds this in
+        addBlock(std::max(block->size * 2, bytes + alignment));
+        block = &blocks.back();
+        base = reinterpret_cast<std::uintptr_t>(block->memory);
+        aligned = (base + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+    }
+
+    block->offset = aligned - base + bytes;
+    ++frameAllocations;
+    return block->memory + (aligned - base);
+}
+
+void FrameArena::reset() {
+    peakBytes = std::max(peakBytes, getUsedBytes());
+    frameAllocations = 0;
+
+    // One block as large as everything this frame needed
+    if (blocks.size() > 1) {
+        std::size_t capacity = getCapacity();
+        for (const Block& block : blocks) {
+            ::operator delete(block.memory);
+        }
+        blocks.clear();
+        addBlock(capacity);
+    }
+    blocks.back().offset = 0;
+}
+
+std::size_t FrameArena::getUsedBytes() const {
+    std::size_t used = 0;
+    for (const Block& block : blocks) {
+        used += block.offset;
+    }
+    return used;
+}
+
+std::size_t FrameArena::getCapacity() const {
+    std::size_t capacity = 0;
+    for (const Block& block : blocks) {
+        capacity += block.size;
+    }
+    return capacity;
+}
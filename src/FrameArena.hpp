@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+// Bump allocator for data that only lives until the end of the frame.
+// Allocating bumps a pointer inside the current block and deallocating does
+// nothing; reset() at the top of the next frame drops everything at once.
+// A frame that outgrows the block chains on more blocks, and the following
+// reset() swaps them for one block as big as all of them, so a steady
+// workload settles into a single block and stops touching the global
+// allocator. Not thread-safe: each thread that wants one owns its own.
+//
+// Hand it to pmr containers (FrameVector, FrameString) as their memory
+// resource. Nothing allocated from it may be used after reset().
+class FrameArena : public std::pmr::memory_resource {
+private:
+    struct Block {
+        std::byte* memory;
+        std::size_t size;
+        std::size_t offset;  // Bytes handed out, alignment padding included
+    };
+
+    std::vector<Block> blocks;  // Allocations come from the last one
+    std::size_t frameAllocations;
+    std::size_t peakBytes;
+
+    void addBlock(std::size_t size);
+
+protected:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void*, std::size_t, std::size_t) override {}
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+public:
+    static constexpr std::size_t DEFAULT_BLOCK_SIZE = 256 * 1024;
+
+    explicit FrameArena(std::size_t initialBytes = DEFAULT_BLOCK_SIZE);
+    ~FrameArena() override;
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    // Free everything allocated since the last reset
+    void reset();
+
+    // This frame so far
+    std::size_t getUsedBytes() const;
+    std::size_t getAllocationCount() const { return frameAllocations; }
+
+    std::size_t getCapacity() const;
+    std::size_t getBlockCount() const { return blocks.size(); }
+
+    // Largest frame seen, measured at reset()
+    std::size_t getPeakBytes() const { return peakBytes; }
+};
+
+// Containers for frame scratch; construct them with the arena
+template <typename T>
+using FrameVector = std::pmr::vector<T>;
+using FrameString = std::pmr::string;
@@ -1,7 +1,8 @@
 #ifndef GAME_ENTITIES_HPP
 #define GAME_ENTITIES_HPP
 
-#include <SFML/Graphics.hpp>
+#include "InternedString.hpp"
+#include <SFML/System/Vector2.hpp>
 #include <string>
 
 namespace game {
@@ -33,9 +34,24 @@ struct TileStats {
     int defense = 0;
     int food = 0;
     int production = 0;
+    int gold = 0;
 };
 
-// Tile types
+// What working a tile gives a city each turn
+struct TileYield {
+    int food = 0;
+    int production = 0;
+    int gold = 0;
+    
+    TileYield& operator+=(const TileYield& other) {
+        food += other.food;
+        production += other.production;
+        gold += other.gold;
+        return *this;
+    }
+};
+
+// Tile types; per-terrain data lives in Definitions, indexed by this enum
 enum class TileType {
     Plains,
     Hills,
@@ -53,42 +69,23 @@ struct Tile {
     bool revealed = false;
     bool visible = false;
     
-    // Base resource production based on tile type
-    Resource getBaseProduction() const {
-        Resource baseResource;
-        switch(type) {
-            case TileType::Water:
-                baseResource.type = ResourceType::Food;
-                baseResource.quantity = 1;
-                break;
-            case TileType::Mountain:
-                baseResource.type = ResourceType::Stone;
-                baseResource.quantity = 1;
-                break;
-            case TileType::Forest:
-                baseResource.type = ResourceType::Wood;
-                baseResource.quantity = 2;
-                break;
-            case TileType::Plains:
-                baseResource.type = ResourceType::Food;
-                baseResource.quantity = 2;
-                break;
-            case TileType::Hills:
-                baseResource.type = ResourceType::Stone;
-                baseResource.quantity = 1;
-                break;
-        }
-        return baseResource;
+    TileYield getYield() const {
+        TileYield yield;
+        yield.food = stats.food;
+        yield.production = stats.production;
+        yield.gold = stats.gold;
+        return yield;
     }
 };
 
+// Merchant stock; text is interned, so selling copies no strings
 struct InventoryItem {
-    std::string name;
-    std::string description;
+    InternedString name;
+    InternedString description;
     int value;
     bool isEquipped;
 
-    InventoryItem(const std::string& n, const std::string& desc, int val)
+    InventoryItem(InternedString n, InternedString desc, int val)
         : name(n), description(desc), value(val), isEquipped(false) {}
 };
 
@@ -109,6 +106,7 @@ struct City {
 
 // Use the game namespace in the global scope
 using game::TileStats;
+using game::TileYield;
 using game::TileType;
 using game::UnitType;
 using game::Tile;
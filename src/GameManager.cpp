@@ -1,21 +1,10 @@
 #include "GameManager.hpp"
-#include <iostream>
+#include "Definitions.hpp"
+#include "Log.hpp"
+#include "Systems.hpp"
 
-GameManager::GameManager()
-    : playerHero(nullptr), playerArmy(nullptr), selectedType(SelectedEntityType::None) {
-}
-
-GameManager::~GameManager() {
-    // Clean up dynamically allocated objects
-    if (playerHero) {
-        delete playerHero;
-        playerHero = nullptr;
-    }
-    
-    if (playerArmy) {
-        delete playerArmy;
-        playerArmy = nullptr;
-    }
+GameManager::GameManager(World& gameWorld)
+    : world(gameWorld), merchantManager(gameWorld), selectedType(SelectedEntityType::None) {
 }
 
 // Added implementation of this method to fix the "const" issue
@@ -23,48 +12,33 @@ NPCMerchant* GameManager::getSelectedMerchant() const {
     return isMerchantSelected() ? merchantManager.getSelectedMerchant() : nullptr;
 }
 
-void GameManager::initialize(const sf::Vector2f& startPosition, const sf::Font& font) {
-    // Load textures first
-    if (!loadTextures()) {
-        std::cerr << "Failed to load game textures!" << std::endl;
-    }
-    
-    playerHero = new Hero(startPosition, "Aragorn", font);
-    playerArmy = new Army(playerHero);
-    playerArmy->addUnit(ArmyUnit("Footman", ArmyUnitType::Infantry, 100, 10, 8, 50));
-    playerArmy->addUnit(ArmyUnit("Archer", ArmyUnitType::Archer, 80, 15, 5, 70));
-
-    addMerchant("Blacksmith", sf::Vector2f(startPosition.x + 200, startPosition.y - 150), font);
-    addMerchant("Armorer", sf::Vector2f(startPosition.x - 250, startPosition.y + 100), font);
-    addMerchant("Arcane Goods", sf::Vector2f(startPosition.x + 300, startPosition.y + 300), font);
-
-    merchantManager.setFontForAllMerchants(font);
-}
+void GameManager::initialize(const sf::Vector2f& startPosition) {
+    playerHero = world.create();
+    world.setPosition(playerHero, startPosition);
+    world.movements.add(playerHero);
+    world.addSelectable(playerHero, 15.0f, true);
+    world.heroes.add(playerHero, "Aragorn");
 
-bool GameManager::loadTextures() {
-    // Load soldier sprite texture
-    if (!soldierTexture.loadFromFile("../src/assets/soldier.png")) {
-        std::cerr << "Failed to load soldier.png texture!" << std::endl;
-        return false;
+    // The army is its own entity; hero and army refer to each other by handle
+    playerArmy = world.create();
+    Army& army = world.armies.add(playerArmy, playerHero);
+    world.heroes.get(playerHero)->setArmy(playerArmy);
+    for (std::size_t index : Definitions::getStartingArmy()) {
+        const Definitions::UnitDefinition& unit = Definitions::getUnit(index);
+        army.addUnit(ArmyUnit(unit.name, unit.type, unit.health, unit.attack, unit.defense, unit.cost));
     }
-    
-    std::cout << "Successfully loaded soldier sprite texture" << std::endl;
-    return true;
+
+    addMerchant("Blacksmith", sf::Vector2f(startPosition.x + 200, startPosition.y - 150));
+    addMerchant("Armorer", sf::Vector2f(startPosition.x - 250, startPosition.y + 100));
+    addMerchant("Arcane Goods", sf::Vector2f(startPosition.x + 300, startPosition.y + 300));
 }
 
-void GameManager::setFont(const sf::Font& font) {
-    // Set font for the hero
-    if (playerHero) {
-        playerHero->setFont(font);
-    }
-    
-    // Set font for merchants
-    merchantManager.setFontForAllMerchants(font);
+void GameManager::addMerchant(const std::string& name, const sf::Vector2f& position) {
+    merchantManager.addMerchant(name, position);
 }
 
-void GameManager::addMerchant(const std::string& name, const sf::Vector2f& position, const sf::Font& font) {
-    NPCMerchant merchant(name, position, font);
-    merchantManager.addMerchant(merchant);
+void GameManager::setHeroPath(const std::vector<sf::Vector2f>& path) {
+    Systems::setPath(world, playerHero, path);
 }
 
 bool GameManager::trySelectEntityAt(const sf::Vector2f& position) {
@@ -72,17 +46,17 @@ bool GameManager::trySelectEntityAt(const sf::Vector2f& position) {
     deselectAll();
     
     // Try to select the hero
-    if (playerHero && playerHero->contains(position)) {
+    if (world.pickAt(world.heroes, position) == playerHero) {
         selectedType = SelectedEntityType::Hero;
-        playerHero->setSelected(true);
-        std::cout << "Selected player hero." << std::endl;
+        world.selectables.get(playerHero)->selected = true;
+        LOG_INFO("input", "Selected player hero");
         return true;
     }
     
     // Try to select a merchant
     if (merchantManager.selectMerchantAt(position)) {
         selectedType = SelectedEntityType::Merchant;
-        std::cout << "Selected merchant: " << merchantManager.getSelectedMerchant()->getName() << std::endl;
+        LOG_INFO("input", "Selected merchant: {}", merchantManager.getSelectedMerchant()->getName());
         return true;
     }
     
@@ -94,8 +68,10 @@ bool GameManager::trySelectEntityAt(const sf::Vector2f& position) {
 
 void GameManager::deselectAll() {
     // Reset selection state
-    if (isHeroSelected() && playerHero) {
-        playerHero->setSelected(false);
+    if (isHeroSelected()) {
+        if (Selectable* heroSelectable = world.selectables.get(playerHero)) {
+            heroSelectable->selected = false;
+        }
     }
     
     if (isMerchantSelected()) {
@@ -106,57 +82,36 @@ void GameManager::deselectAll() {
 }
 
 bool GameManager::purchaseUnitFromMerchant(int unitIndex) {
-    if (!isMerchantSelected() || !playerHero) {
+    Hero* hero = getPlayerHero();
+    if (!isMerchantSelected() || !hero) {
         return false;
     }
     
     NPCMerchant* merchant = merchantManager.getSelectedMerchant();
     if (merchant) {
-        return merchant->sellUnitTo(playerHero, unitIndex);
+        return merchant->sellUnitTo(hero, world.armies.get(hero->getArmy()), unitIndex);
     }
     
     return false;
 }
 
 bool GameManager::purchaseItemFromMerchant(int itemIndex) {
-    if (!isMerchantSelected() || !playerHero) {
+    Hero* hero = getPlayerHero();
+    if (!isMerchantSelected() || !hero) {
         return false;
     }
     
     NPCMerchant* merchant = merchantManager.getSelectedMerchant();
     if (merchant) {
-        return merchant->sellItemTo(playerHero, itemIndex);
+        return merchant->sellItemTo(hero, itemIndex);
     }
     
     return false;
 }
 
 void GameManager::update(float deltaTime) {
-    // Update hero
-    if (playerHero) {
-        playerHero->update(deltaTime);
-        
-        // If hero moved, update army formation
-        if (playerArmy) {
-            playerArmy->updateFormation(playerHero->getPosition());
-        }
-    }
+    // Hero movement is handled by Systems::updateMovement
     
     // Update merchants
     merchantManager.update(deltaTime);
 }
-
-void GameManager::draw(sf::RenderWindow& window) {
-    // Draw merchants
-    merchantManager.draw(window);
-    
-    // Draw army if exists (drawn before hero so hero is on top)
-    if (playerArmy) {
-        playerArmy->draw(window);
-    }
-    
-    // Draw hero with sprite texture if exists
-    if (playerHero) {
-        playerHero->drawSprite(window, soldierTexture);
-    }
-}
\ No newline at end of file
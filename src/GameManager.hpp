@@ -3,24 +3,24 @@
 #include "Hero.hpp"
 #include "Army.hpp"
 #include "NPCMerchant.hpp"
-#include <SFML/Graphics.hpp>
-#include <memory>
+#include "World.hpp"
+#include <SFML/System/Vector2.hpp>
+#include <vector>
 
 // Central class to manage game elements
 class GameManager {
 private:
+    World& world;
+    
     // The player's hero
-    Hero* playerHero;
+    Entity playerHero;
     
     // The player's army
-    Army* playerArmy;
+    Entity playerArmy;
     
     // Merchant manager to handle all merchants
     MerchantManager merchantManager;
     
-    // Sprite textures for 2.5D rendering
-    sf::Texture soldierTexture;
-    
     // Selected game element
     enum class SelectedEntityType {
         None,
@@ -32,27 +32,26 @@ private:
     SelectedEntityType selectedType;
     
 public:
-    GameManager();
-    ~GameManager();
+    explicit GameManager(World& world);
     
     // Initialization
-    void initialize(const sf::Vector2f& startPosition, const sf::Font& font);
-    
-    // Texture management
-    const sf::Texture& getSoldierTexture() const { return soldierTexture; }
-    bool loadTextures();
+    void initialize(const sf::Vector2f& startPosition);
     
     // Hero management
-    Hero* getPlayerHero() const { return playerHero; }
+    Hero* getPlayerHero() const { return world.heroes.get(playerHero); }
+    Entity getPlayerHeroEntity() const { return playerHero; }
+    const sf::Vector2f* getHeroPosition() const { return world.getPosition(playerHero); }
+    void setHeroPath(const std::vector<sf::Vector2f>& path);
     
     // Army management
-    Army* getPlayerArmy() const { return playerArmy; }
+    Army* getPlayerArmy() const { return world.armies.get(playerArmy); }
+    Hero* getArmyLeader(const Army* army) const { return army ? world.heroes.get(army->getLeader()) : nullptr; }
     
     // Merchant management
     MerchantManager& getMerchantManager() { return merchantManager; }
     
     // Adds a merchant at the specified position
-    void addMerchant(const std::string& name, const sf::Vector2f& position, const sf::Font& font);
+    void addMerchant(const std::string& name, const sf::Vector2f& position);
     
     // Check for interactions at a position
     bool trySelectEntityAt(const sf::Vector2f& position);
@@ -66,8 +65,8 @@ public:
     bool isMerchantSelected() const { return selectedType == SelectedEntityType::Merchant; }
     
     // Selection getters
-    Hero* getSelectedHero() const { return isHeroSelected() ? playerHero : nullptr; }
-    Army* getSelectedArmy() const { return isArmySelected() ? playerArmy : nullptr; }
+    Hero* getSelectedHero() const { return isHeroSelected() ? getPlayerHero() : nullptr; }
+    Army* getSelectedArmy() const { return isArmySelected() ? getPlayerArmy() : nullptr; }
     NPCMerchant* getSelectedMerchant() const; // Implementation moved to cpp file
     
     // Handle unit purchases from merchants
@@ -79,9 +78,4 @@ public:
     // Update game state
     void update(float deltaTime);
     
-    // Render game entities
-    void draw(sf::RenderWindow& window);
-    
-    // Set font for merchants
-    void setFont(const sf::Font& font);
 };
\ No newline at end of file
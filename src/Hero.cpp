@@ -1,50 +1,38 @@
-#include <SFML/Graphics.hpp>
 #include "Hero.hpp"
 #include "Army.hpp"
-#include "RomanUI.hpp"
-#include <iostream>
+#include "Definitions.hpp"
+#include "Log.hpp"
 #include <cmath>
 
-Hero::Hero(const sf::Vector2f& pos, const std::string& heroName, const sf::Font& font)
-    : PlayerUnit(pos, UnitType::Warrior), // Heroes are special warriors
-      name(heroName),
+Hero::Hero(const std::string& heroName)
+    : name(heroName),
       level(1),
       experience(0),
       experienceToNextLevel(calculateExperienceForLevel(2)),
-      gold(100),
-      army(nullptr),
-      levelText(font, "", 14),  // Initialize with the provided font
-      goldText(font, "", 14)    // Initialize with the provided font
+      gold(100)
 {
-    // Get a reference to the base class shape (assuming a protected getter exists)
-    sf::CircleShape& shape = getShape(); 
-    
-    // Setup hero appearance - override the base PlayerUnit
-    sf::Color heroColor = sf::Color(50, 150, 255); // Blue for heroes
-    shape.setFillColor(heroColor);
-    shape.setOutlineThickness(3.0f);
-    shape.setOutlineColor(sf::Color::White);
-    
+    initializeDefaults();
+}
+
+void Hero::initializeDefaults() {
     // Initialize attributes
     attributes[HeroAttribute::Strength] = 5;
     attributes[HeroAttribute::Intelligence] = 5;
     attributes[HeroAttribute::Dexterity] = 5;
     attributes[HeroAttribute::Vitality] = 5;
     
-    // Initialize default skills and items
-    initializeDefaults();
-}
-
-void Hero::initializeDefaults() {
     // Add basic skills
-    skills.push_back(Skill("Strength", "Increases physical damage", 1));
-    skills.push_back(Skill("Defense", "Reduces damage taken", 1));
-    skills.push_back(Skill("Leadership", "Improves army performance", 1));
+    for (std::size_t index : Definitions::getStartingSkills()) {
+        const Definitions::SkillDefinition& skill = Definitions::getSkill(index);
+        skills.push_back(Skill(skill.name, skill.description, skill.level, skill.maxLevel));
+    }
     
-    // Add starting inventory
-    inventory.push_back(InventoryItem("Bronze Sword", "A basic sword", 50));
-    inventory.push_back(InventoryItem("Leather Armor", "Basic armor", 75));
-    inventory.push_back(InventoryItem("Health Potion", "Restores 50 health", 25));
+    // Every slot up front, so purchases never reallocate
+    inventory.reserve(INVENTORY_SLOTS);
+    for (std::size_t index : Definitions::getStartingItems()) {
+        const Definitions::ItemDefinition& item = Definitions::getItem(index);
+        addItem(InventoryItem(item.name, item.description, item.value));
+    }
 }
 
 int Hero::calculateExperienceForLevel(int targetLevel) {
@@ -52,47 +40,6 @@ int Hero::calculateExperienceForLevel(int targetLevel) {
     return targetLevel * targetLevel * 100;
 }
 
-void Hero::setFont(const sf::Font& font) {
-    levelText.setFont(font);
-    levelText.setCharacterSize(14);
-    levelText.setFillColor(sf::Color::White);
-    levelText.setOutlineColor(sf::Color::Black);
-    levelText.setOutlineThickness(1.0f);
-    
-    goldText.setFont(font);
-    goldText.setCharacterSize(14);
-    goldText.setFillColor(sf::Color::Yellow);
-    goldText.setOutlineColor(sf::Color::Black);
-    goldText.setOutlineThickness(1.0f);
-}
-
-void Hero::draw(sf::RenderWindow& window) {
-    // Draw the hero unit (via base class)
-    PlayerUnit::draw(window);
-
-    // Draw level and gold info above hero
-    sf::Vector2f pos = getPosition();
-
-    // Update level text
-    /*
-    levelText.setString("Lvl " + std::to_string(level));
-    sf::FloatRect levelBounds = levelText.getLocalBounds();
-    levelText.setPosition(pos.x - (2.0f), pos.y - 40.f);
-    window.draw(levelText);
-
-    // Update gold text
-    goldText.setString(std::to_string(gold) + " gold");
-    sf::FloatRect goldBounds = goldText.getLocalBounds();
-    goldText.setPosition(pos.x - (2.0f), pos.y - 25.f);
-    window.draw(goldText);
-    */
-}
-
-void Hero::drawSprite(sf::RenderWindow& window, const sf::Texture& spriteTexture) {
-    // Use the sprite-based rendering from RomanUI
-    RomanUI::drawSpriteCharacter(window, getPosition(), spriteTexture, getSelected());
-}
-
 void Hero::addExperience(int exp) {
     experience += exp;
     
@@ -112,11 +59,16 @@ void Hero::levelUp() {
     attributes[HeroAttribute::Strength]++;
     attributes[HeroAttribute::Vitality]++;
     
-    std::cout << name << " leveled up to level " << level << "!" << std::endl;
+    LOG_INFO("hero", "{} leveled up to level {}", name, level);
 }
 
-void Hero::addItem(const InventoryItem& item) {
+bool Hero::addItem(const InventoryItem& item) {
+    if (isInventoryFull()) {
+        LOG_INFO("hero", "Inventory is full, {} not added", item.name);
+        return false;
+    }
     inventory.push_back(item);
+    return true;
 }
 
 void Hero::removeItem(int index) {
@@ -155,34 +107,34 @@ int Hero::getAttribute(HeroAttribute attr) const {
 
 void Hero::upgradeSkill(int index) {
     if (index < 0 || index >= static_cast<int>(skills.size())) {
-        std::cout << "Invalid skill index." << std::endl;
+        LOG_WARN("hero", "Invalid skill index {}", index);
         return;
     }
     
     Skill& skill = skills[index];
     
     if (skill.level >= skill.maxLevel) {
-        std::cout << "Skill already at maximum level." << std::endl;
+        LOG_INFO("hero", "Skill already at maximum level");
         return;
     }
     
     // Increase skill level
     skill.level++;
     
-    std::cout << "Upgraded " << skill.name << " to level " << skill.level << "." << std::endl;
+    LOG_INFO("hero", "Upgraded {} to level {}", skill.name, skill.level);
 }
 
 void Hero::equipItem(int index, bool equip) {
     if (index < 0 || index >= static_cast<int>(inventory.size())) {
-        std::cout << "Invalid inventory index." << std::endl;
+        LOG_WARN("hero", "Invalid inventory index {}", index);
         return;
     }
     
     inventory[index].isEquipped = equip;
     
     if (equip) {
-        std::cout << "Equipped " << inventory[index].name << "." << std::endl;
+        LOG_INFO("hero", "Equipped {}", inventory[index].name);
     } else {
-        std::cout << "Unequipped " << inventory[index].name << "." << std::endl;
+        LOG_INFO("hero", "Unequipped {}", inventory[index].name);
     }
 }
\ No newline at end of file
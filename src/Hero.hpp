@@ -1,34 +1,31 @@
 #pragma once
 
 #include "GameEntities.hpp"
-#include "PlayerUnit.hpp"
-#include <SFML/Graphics.hpp>
+#include "Ecs.hpp"
+#include "InternedString.hpp"
 #include <vector>
 #include <string>
 #include <map>
 
-// Forward declaration
-class Army;
-
-// Item structure for hero inventory
+// Item structure for hero inventory; text is interned, so items copy for free
 struct InventoryItem {
-    std::string name;
-    std::string description;
+    InternedString name;
+    InternedString description;
     int value;
     bool isEquipped;
     
-    InventoryItem(const std::string& n, const std::string& d, int v) 
+    InventoryItem(InternedString n, InternedString d, int v) 
         : name(n), description(d), value(v), isEquipped(false) {}
 };
 
 // Skill structure for hero abilities
 struct Skill {
-    std::string name;
-    std::string description;
+    InternedString name;
+    InternedString description;
     int level;
     int maxLevel;
     
-    Skill(const std::string& n, const std::string& d, int l = 1, int ml = 5) 
+    Skill(InternedString n, InternedString d, int l = 1, int ml = 5) 
         : name(n), description(d), level(l), maxLevel(ml) {}
 };
 
@@ -40,8 +37,13 @@ enum class HeroAttribute {
     Vitality
 };
 
-// Hero class
-class Hero : public PlayerUnit {
+// Hero stats, skills and inventory.
+// Position, movement and selection live in the hero entity's other components.
+class Hero {
+public:
+    // Inventory size; the hero panel has one slot per item
+    static constexpr int INVENTORY_SLOTS = 12;
+
 private:
     std::string name;
     int level;
@@ -58,19 +60,14 @@ private:
     std::vector<Skill> skills;
     std::vector<InventoryItem> inventory;
     
-    // Army reference
-    Army* army;
-    
-    // UI elements
-    sf::Text levelText;
-    sf::Text goldText;
+    // Army entity following this hero
+    Entity army;
     
     // Method to calculate experience needed for next level
     int calculateExperienceForLevel(int level);
     
 public:
-    // Updated constructor to take a font
-    Hero(const sf::Vector2f& pos, const std::string& heroName, const sf::Font& font);
+    explicit Hero(const std::string& heroName);
     
     // Basic getters and setters
     const std::string& getName() const { return name; }
@@ -87,8 +84,9 @@ public:
     void addExperience(int exp);
     void levelUp();
     
-    // Inventory management
-    void addItem(const InventoryItem& item);
+    // Inventory management; addItem refuses items once every slot is taken
+    bool addItem(const InventoryItem& item);
+    bool isInventoryFull() const { return inventory.size() >= static_cast<std::size_t>(INVENTORY_SLOTS); }
     void removeItem(int index);
     const std::vector<InventoryItem>& getInventory() const { return inventory; }
     void equipItem(int index, bool equip);
@@ -103,17 +101,8 @@ public:
     bool spendGold(int amount);
     
     // Army management
-    void setArmy(Army* newArmy) { army = newArmy; }
-    Army* getArmy() const { return army; }
-    
-    // Draw hero with UI elements - virtual from PlayerUnit
-    void draw(sf::RenderWindow& window);
-    
-    // Draw hero with sprite texture for 2.5D rendering
-    void drawSprite(sf::RenderWindow& window, const sf::Texture& spriteTexture);
-
-    // Set font for UI elements
-    void setFont(const sf::Font& font);
+    void setArmy(Entity newArmy) { army = newArmy; }
+    Entity getArmy() const { return army; }
     
     // Initialize with default skills and attributes
     void initializeDefaults();
@@ -1,31 +1,19 @@
 #include "HeroesGraphics.hpp"
+#include "Definitions.hpp"
 #include <cmath>
 
 namespace HeroesGraphics {
     
     sf::Color getTileColor(game::TileType type, bool isShaded) {
-        sf::Color baseColor;
-        
-        switch (type) {
-            case game::TileType::Plains:
-                baseColor = Colors::GRASS_GREEN;
-                break;
-            case game::TileType::Hills:
-                baseColor = Colors::DIRT_BROWN;
-                break;
-            case game::TileType::Mountain:
-                baseColor = Colors::MOUNTAIN_GRAY;
-                break;
-            case game::TileType::Forest:
-                baseColor = Colors::FOREST_DARK_GREEN;
-                break;
-            case game::TileType::Water:
-                baseColor = Colors::WATER_BLUE;
-                break;
-            default:
-                baseColor = Colors::GRASS_GREEN;
-                break;
-        }
+        // This theme's own palette, in TileType order
+        static const sf::Color palette[Definitions::TERRAIN_COUNT] = {
+            Colors::GRASS_GREEN,        // Plains
+            Colors::DIRT_BROWN,         // Hills
+            Colors::MOUNTAIN_GRAY,      // Mountain
+            Colors::FOREST_DARK_GREEN,  // Forest
+            Colors::WATER_BLUE          // Water
+        };
+        const sf::Color& baseColor = palette[static_cast<std::size_t>(type)];
         
         if (isShaded) {
             // Darken the color for shading effect
@@ -55,7 +43,7 @@ namespace HeroesGraphics {
         }
     }
     
-    void drawDetailedHexagon(sf::RenderWindow& window, const game::Tile& tile, float hexSize) {
+    void drawDetailedHexagon(DrawTarget& window, const game::Tile& tile, float hexSize) {
         const sf::Vector2f& center = tile.center;
         
         // Create hexagon with 6 points
@@ -168,7 +156,7 @@ namespace HeroesGraphics {
         return button;
     }
     
-    void drawResourceIcon(sf::RenderWindow& window, game::ResourceType type, const sf::Vector2f& position, int amount, const sf::Font& font) {
+    void drawResourceIcon(DrawTarget& window, game::ResourceType type, const sf::Vector2f& position, int amount, const sf::Font& font) {
         // Draw resource icon background
         sf::CircleShape icon(12.0f);
         icon.setPosition(sf::Vector2f(position.x - 12, position.y - 12));
@@ -204,7 +192,7 @@ namespace HeroesGraphics {
         window.draw(amountText);
     }
     
-    void drawUnit(sf::RenderWindow& window, const sf::Vector2f& position, UnitType type, bool isSelected) {
+    void drawUnit(DrawTarget& window, const sf::Vector2f& position, UnitType type, bool isSelected) {
         // Draw unit base
         sf::CircleShape unitBase(15.0f);
         unitBase.setPosition(sf::Vector2f(position.x - 15, position.y - 15));
@@ -239,7 +227,7 @@ namespace HeroesGraphics {
         window.draw(symbol);
     }
     
-    void drawHero(sf::RenderWindow& window, const sf::Vector2f& position, bool isSelected) {
+    void drawHero(DrawTarget& window, const sf::Vector2f& position, bool isSelected) {
         // Draw hero base (larger than regular units)
         sf::CircleShape heroBase(20.0f);
         heroBase.setPosition(sf::Vector2f(position.x - 20, position.y - 20));
@@ -269,7 +257,7 @@ namespace HeroesGraphics {
         window.draw(crown);
     }
     
-    void drawCity(sf::RenderWindow& window, const sf::Vector2f& position, const std::string& name, const sf::Font& font) {
+    void drawCity(DrawTarget& window, const sf::Vector2f& position, const std::string& name, const sf::Font& font) {
         // Draw city base (larger hexagonal foundation)
         sf::ConvexShape cityBase;
         cityBase.setPointCount(6);
@@ -353,7 +341,7 @@ namespace HeroesGraphics {
         window.draw(cityName);
     }
     
-    void drawHeroesBorder(sf::RenderWindow& window, float x, float y, float width, float height) {
+    void drawHeroesBorder(DrawTarget& window, float x, float y, float width, float height) {
         // Outer border - dark brown
         sf::RectangleShape outerBorder(sf::Vector2f(width, height));
         outerBorder.setPosition(sf::Vector2f(x, y));
@@ -383,7 +371,7 @@ namespace HeroesGraphics {
         }
     }
     
-    void drawMinimap(sf::RenderWindow& window, float x, float y, float size, const sf::Vector2f& playerPosition) {
+    void drawMinimap(DrawTarget& window, float x, float y, float size, const sf::Vector2f& playerPosition) {
         // Minimap background
         sf::RectangleShape minimapBg(sf::Vector2f(size, size));
         minimapBg.setPosition(sf::Vector2f(x, y));
@@ -419,7 +407,7 @@ namespace HeroesGraphics {
         window.draw(playerIndicator);
     }
     
-    void drawTerrainTransition(sf::RenderWindow& window, const game::Tile& tile, const std::vector<std::vector<game::Tile>>& tileMap, int x, int y, float hexSize) {
+    void drawTerrainTransition(DrawTarget& window, const game::Tile& tile, const std::vector<std::vector<game::Tile>>& tileMap, int x, int y, float hexSize) {
         // Check neighboring tiles for terrain transitions
         const sf::Vector2f& center = tile.center;
         
@@ -470,7 +458,7 @@ namespace HeroesGraphics {
         }
     }
     
-    void drawResourceDeposit(sf::RenderWindow& window, const sf::Vector2f& position, game::ResourceType type, float hexSize) {
+    void drawResourceDeposit(DrawTarget& window, const sf::Vector2f& position, game::ResourceType type, float hexSize) {
         // Draw larger, more prominent resource deposits
         sf::ConvexShape deposit;
         
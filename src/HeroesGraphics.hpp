@@ -3,6 +3,7 @@
 
 #include <SFML/Graphics.hpp>
 #include "GameEntities.hpp"
+#include "DrawTarget.hpp"
 
 namespace HeroesGraphics {
     // Heroes of Might and Magic 3 inspired color palette
@@ -41,7 +42,7 @@ namespace HeroesGraphics {
     sf::Color getResourceColor(game::ResourceType type);
     
     // Create detailed hexagon with texture-like appearance
-    void drawDetailedHexagon(sf::RenderWindow& window, const game::Tile& tile, float hexSize);
+    void drawDetailedHexagon(DrawTarget& window, const game::Tile& tile, float hexSize);
     
     // Create UI elements with HoMM3 style
     sf::RectangleShape createHeroesPanel(float x, float y, float width, float height);
@@ -49,18 +50,18 @@ namespace HeroesGraphics {
     sf::RectangleShape createHeroesButton(float x, float y, float width, float height);
     
     // Draw resource icons
-    void drawResourceIcon(sf::RenderWindow& window, game::ResourceType type, const sf::Vector2f& position, int amount, const sf::Font& font);
+    void drawResourceIcon(DrawTarget& window, game::ResourceType type, const sf::Vector2f& position, int amount, const sf::Font& font);
     
     // Enhanced unit/hero graphics
-    void drawUnit(sf::RenderWindow& window, const sf::Vector2f& position, UnitType type, bool isSelected = false);
-    void drawHero(sf::RenderWindow& window, const sf::Vector2f& position, bool isSelected = false);
-    void drawCity(sf::RenderWindow& window, const sf::Vector2f& position, const std::string& name, const sf::Font& font);
+    void drawUnit(DrawTarget& window, const sf::Vector2f& position, UnitType type, bool isSelected = false);
+    void drawHero(DrawTarget& window, const sf::Vector2f& position, bool isSelected = false);
+    void drawCity(DrawTarget& window, const sf::Vector2f& position, const std::string& name, const sf::Font& font);
     
     // UI enhancements
-    void drawHeroesBorder(sf::RenderWindow& window, float x, float y, float width, float height);
-    void drawMinimap(sf::RenderWindow& window, float x, float y, float size, const sf::Vector2f& playerPosition);
-    void drawTerrainTransition(sf::RenderWindow& window, const game::Tile& tile, const std::vector<std::vector<game::Tile>>& tileMap, int x, int y, float hexSize);
-    void drawResourceDeposit(sf::RenderWindow& window, const sf::Vector2f& position, game::ResourceType type, float hexSize);
+    void drawHeroesBorder(DrawTarget& window, float x, float y, float width, float height);
+    void drawMinimap(DrawTarget& window, float x, float y, float size, const sf::Vector2f& playerPosition);
+    void drawTerrainTransition(DrawTarget& window, const game::Tile& tile, const std::vector<std::vector<game::Tile>>& tileMap, int x, int y, float hexSize);
+    void drawResourceDeposit(DrawTarget& window, const sf::Vector2f& position, game::ResourceType type, float hexSize);
 }
 
 #endif // HEROES_GRAPHICS_HPP
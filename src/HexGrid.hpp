@@ -0,0 +1,108 @@
+#pragma once
+
+#include <SFML/System/Vector2.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+// Helpers for the odd-r tile layout used by the map: tileMap[q][r], where q is
+// the column and r the row, and odd rows are shifted half a hex to the right.
+namespace HexGrid {
+    // Steps between two tiles
+    inline int distance(const sf::Vector2i& a, const sf::Vector2i& b) {
+        // Through cube coordinates
+        int ax = a.x - (a.y - (a.y & 1)) / 2;
+        int bx = b.x - (b.y - (b.y & 1)) / 2;
+        int dx = ax - bx;
+        int dz = a.y - b.y;
+        int dy = -dx - dz;
+        return (std::abs(dx) + std::abs(dy) + std::abs(dz)) / 2;
+    }
+
+    // Adjacent tile in direction 0..5: east, then clockwise on screen
+    // (south-east, south-west, west, north-west, north-east)
+    inline sf::Vector2i neighbor(const sf::Vector2i& tile, int direction) {
+        // Odd rows sit half a hex further right
+        int shift = tile.y & 1;
+        switch (direction) {
+            case 0: return sf::Vector2i(tile.x + 1, tile.y);
+            case 1: return sf::Vector2i(tile.x + shift, tile.y + 1);
+            case 2: return sf::Vector2i(tile.x - 1 + shift, tile.y + 1);
+            case 3: return sf::Vector2i(tile.x - 1, tile.y);
+            case 4: return sf::Vector2i(tile.x - 1 + shift, tile.y - 1);
+            default: return sf::Vector2i(tile.x + shift, tile.y - 1);
+        }
+    }
+
+    // Corner 0..5 of a pointy-top hex, matching the tile drawing code.
+    // The side facing neighbor direction d runs from corner (d + 5) % 6 to corner d.
+    inline sf::Vector2f corner(const sf::Vector2f& center, float hexSize, int index) {
+        float angle = 3.14159265f / 180.f * (60.f * index + 30.f);
+        return sf::Vector2f(center.x + hexSize * std::cos(angle), center.y + hexSize * std::sin(angle));
+    }
+
+    // Call fn(tile) for each tile on the straight line from a to b, a first
+    // and b last
+    template <typename Fn>
+    void forEachOnLine(const sf::Vector2i& a, const sf::Vector2i& b, Fn&& fn) {
+        int steps = distance(a, b);
+        // Cube coordinates; the tiny offset keeps lines off hex corners
+        float ax = a.x - (a.y - (a.y & 1)) / 2 + 1e-4f;
+        float az = a.y + 1e-4f;
+        float bx = b.x - (b.y - (b.y & 1)) / 2 + 1e-4f;
+        float bz = b.y + 1e-4f;
+
+        for (int i = 0; i <= steps; ++i) {
+            float t = steps == 0 ? 0.0f : static_cast<float>(i) / steps;
+            float x = ax + (bx - ax) * t;
+            float z = az + (bz - az) * t;
+            float y = -x - z;
+
+            // Round to the nearest hex, fixing up the coordinate that moved most
+            float rx = std::round(x);
+            float ry = std::round(y);
+            float rz = std::round(z);
+            float dx = std::abs(rx - x);
+            float dy = std::abs(ry - y);
+            float dz = std::abs(rz - z);
+            if (dx > dy && dx > dz) {
+                rx = -ry - rz;
+            } else if (dy <= dz) {
+                rz = -rx - ry;
+            }
+
+            int r = static_cast<int>(rz);
+            int q = static_cast<int>(rx) + (r - (r & 1)) / 2;
+            fn(sf::Vector2i(q, r));
+        }
+    }
+
+    // Tile whose row and column best match a world position, clamped to the map.
+    // Exact for tile centers.
+    inline sf::Vector2i worldToTile(const sf::Vector2f& position, float hexSize, int width, int height) {
+        int r = static_cast<int>(std::lround(position.y / (hexSize * 1.5f)));
+        r = std::max(0, std::min(r, height - 1));
+        int q = static_cast<int>(std::lround(position.x / (hexSize * std::sqrt(3.f)) - 0.5f * (r % 2)));
+        q = std::max(0, std::min(q, width - 1));
+        return sf::Vector2i(q, r);
+    }
+
+    // Call fn(tile) for every tile on the map within radius steps of center,
+    // row by row
+    template <typename Fn>
+    void forEachInRadius(const sf::Vector2i& center, int radius, int width, int height, Fn&& fn) {
+        int rowBegin = std::max(0, center.y - radius);
+        int rowEnd = std::min(height - 1, center.y + radius);
+        for (int r = rowBegin; r <= rowEnd; ++r) {
+            // Row shifting moves the column window by at most one
+            int columnBegin = std::max(0, center.x - radius - 1);
+            int columnEnd = std::min(width - 1, center.x + radius + 1);
+            for (int q = columnBegin; q <= columnEnd; ++q) {
+                sf::Vector2i tile(q, r);
+                if (distance(center, tile) <= radius) {
+                    fn(tile);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,54 @@
+#include "InternedString.hpp"
+#include <deque>
+#include <mutex>
+#include <ostream>
+#include <unordered_map>
+
+namespace {
+    // The deque never moves its strings, so the keys can view them
+    struct InternTable {
+        std::mutex mutex;
+        std::deque<std::string> storage;
+        std::unordered_map<std::string_view, const std::string*> entries;
+    };
+
+    // Built on first use, so strings interned during static init work too
+    InternTable& getTable() {
+        static InternTable table;
+        return table;
+    }
+
+    const std::string* getEmptyString() {
+        static const std::string empty;
+        return &empty;
+    }
+}
+
+const std::string* InternedString::intern(std::string_view value) {
+    if (value.empty()) return getEmptyString();
+
+    InternTable& table = getTable();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    auto it = table.entries.find(value);
+    if (it != table.entries.end()) {
+        return it->second;
+    }
+
+    const std::string& stored = table.storage.emplace_back(value);
+    table.entries.emplace(std::string_view(stored), &stored);
+    return &stored;
+}
+
+InternedString::InternedString()
+    : text(getEmptyString()) {
+}
+
+std::size_t InternedString::getInternedCount() {
+    InternTable& table = getTable();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    return table.entries.size();
+}
+
+std::ostream& operator<<(std::ostream& out, const InternedString& value) {
+    return out << value.str();
+}
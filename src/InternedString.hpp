@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+
+// Immutable string stored once for the whole program.
+// Constructing one looks the text up in a global table and adds it the
+// first time it is seen; from then on the handle is a single pointer, so
+// copying, assigning and comparing never touch the heap. Interned text is
+// never freed: use it for names and descriptions from a bounded set, not
+// for text built every frame. Interning is thread-safe.
+class InternedString {
+private:
+    const std::string* text;
+
+    static const std::string* intern(std::string_view value);
+
+public:
+    InternedString();
+    InternedString(const char* value) : text(intern(value)) {}
+    InternedString(const std::string& value) : text(intern(value)) {}
+    explicit InternedString(std::string_view value) : text(intern(value)) {}
+
+    const std::string& str() const { return *text; }
+    const char* c_str() const { return text->c_str(); }
+    std::string_view view() const { return *text; }
+    std::size_t size() const { return text->size(); }
+    bool empty() const { return text->empty(); }
+
+    // Equal text is the same entry, so equality is a pointer compare
+    friend bool operator==(const InternedString& a, const InternedString& b) { return a.text == b.text; }
+    friend bool operator!=(const InternedString& a, const InternedString& b) { return a.text != b.text; }
+
+    // Distinct strings interned so far
+    static std::size_t getInternedCount();
+};
+
+std::ostream& operator<<(std::ostream& out, const InternedString& value);
@@ -0,0 +1,324 @@
+#include "Log.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+namespace Log {
+    namespace {
+        constexpr std::size_t QUEUE_CAPACITY = 2048;  // Power of two
+        constexpr std::chrono::milliseconds WRITER_INTERVAL{5};
+
+        // Bounded multi-producer queue after Vyukov: each slot's sequence
+        // says whose turn it is, so producers claim a slot with one
+        // compare-exchange and never wait on each other or the writer
+        struct alignas(64) Slot {
+            Record record;
+            std::atomic<std::size_t> sequence;
+        };
+        static_assert(std::is_standard_layout_v<Slot>, "commitRecord finds a slot from its record");
+
+        // Static so a late LOG_* racing stop() still has somewhere to write
+        Slot slots[QUEUE_CAPACITY];
+        std::atomic<std::size_t> enqueuePosition{0};
+        std::size_t dequeuePosition = 0;           // Writer thread only
+        std::atomic<std::size_t> writtenPosition{0};
+        std::uint64_t reportedDrops = 0;           // Writer thread only
+
+        std::atomic<std::uint64_t> suppressedTotal{0};
+        std::atomic<std::uint64_t> droppedTotal{0};
+        std::atomic<std::uint32_t> nextThread{0};
+
+        Options settings;
+        std::atomic<std::uint32_t> perSiteLimit{0};
+        const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+        std::atomic<bool> running{false};
+        std::atomic<std::int64_t> currentSecond{0};  // Kept by the writer, so call sites skip the clock
+        std::thread writer;
+
+        std::int64_t now() {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime).count();
+        }
+
+        std::uint32_t threadIndex() {
+            thread_local std::uint32_t index = nextThread.fetch_add(1, std::memory_order_relaxed);
+            return index;
+        }
+
+        // Returns false while the site is over its limit for this second,
+        // otherwise how many it held back since it last printed
+        bool admit(CallSite& site, std::uint32_t& suppressed) {
+            std::uint32_t limit = perSiteLimit.load(std::memory_order_relaxed);
+            if (limit != 0) {
+                std::int64_t window = currentSecond.load(std::memory_order_relaxed);
+                std::int64_t current = site.window.load(std::memory_order_relaxed);
+                if (current != window && site.window.compare_exchange_strong(current, window, std::memory_order_relaxed)) {
+                    site.count.store(0, std::memory_order_relaxed);
+                }
+                if (site.count.load(std::memory_order_relaxed) >= limit ||
+                    site.count.fetch_add(1, std::memory_order_relaxed) >= limit) {
+                    site.suppressed.fetch_add(1, std::memory_order_relaxed);
+                    suppressedTotal.fetch_add(1, std::memory_order_relaxed);
+                    return false;
+                }
+            }
+            suppressed = site.suppressed.exchange(0, std::memory_order_relaxed);
+            return true;
+        }
+
+        const char* levelName(Level level) {
+            switch (level) {
+                case Level::Debug: return "DEBUG";
+                case Level::Info: return "INFO";
+                case Level::Warning: return "WARN";
+                case Level::Error: return "ERROR";
+                default: return "OFF";
+            }
+        }
+
+        void appendArgument(std::string& out, const Record& record, const Argument& argument) {
+            char number[32];
+            switch (argument.type) {
+                case Argument::Type::Signed:
+                    std::snprintf(number, sizeof(number), "%lld", argument.signedValue);
+                    out += number;
+                    break;
+                case Argument::Type::Unsigned:
+                    std::snprintf(number, sizeof(number), "%llu", argument.unsignedValue);
+                    out += number;
+                    break;
+                case Argument::Type::Double:
+                    std::snprintf(number, sizeof(number), "%g", argument.doubleValue);
+                    out += number;
+                    break;
+                case Argument::Type::Bool:
+                    out += argument.unsignedValue ? "true" : "false";
+                    break;
+                case Argument::Type::Literal:
+                    out += argument.literal;
+                    break;
+                case Argument::Type::Copied:
+                    out.append(record.text + argument.copied.offset, argument.copied.length);
+                    break;
+            }
+        }
+
+        void formatMessage(std::string& out, const Record& record) {
+            std::size_t next = 0;
+            for (const char* c = record.format; *c; ++c) {
+                if (c[0] == '{' && c[1] == '}' && next < record.argumentCount) {
+                    appendArgument(out, record, record.arguments[next++]);
+                    ++c;
+                } else {
+                    out += *c;
+                }
+            }
+            if (record.suppressed != 0) {
+                out += " (+";
+                out += std::to_string(record.suppressed);
+                out += " suppressed)";
+            }
+        }
+
+        void appendJsonString(std::string& out, std::string_view text) {
+            out += '"';
+            for (char c : text) {
+                switch (c) {
+                    case '"': out += "\\\""; break;
+                    case '\\': out += "\\\\"; break;
+                    case '\n': out += "\\n"; break;
+                    case '\t': out += "\\t"; break;
+                    default:
+                        if (static_cast<unsigned char>(c) < 0x20) {
+                            char escaped[8];
+                            std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                            out += escaped;
+                        } else {
+                            out += c;
+                        }
+                }
+            }
+            out += '"';
+        }
+
+        void formatRecord(std::string& out, std::string& message, const Record& record) {
+            message.clear();
+            formatMessage(message, record);
+
+            char prefix[64];
+            double seconds = static_cast<double>(record.nanoseconds) / 1e9;
+            if (settings.format == Format::JsonLines) {
+                std::snprintf(prefix, sizeof(prefix), "{\"t\":%.6f,\"level\":\"", seconds);
+                out += prefix;
+                for (const char* c = levelName(record.level); *c; ++c) {
+                    out += static_cast<char>(*c - 'A' + 'a');
+                }
+                out += "\",\"thread\":";
+                out += std::to_string(record.thread);
+                out += ",\"category\":";
+                appendJsonString(out, record.category);
+                out += ",\"message\":";
+                appendJsonString(out, message);
+                out += "}\n";
+            } else {
+                std::snprintf(prefix, sizeof(prefix), "%10.3f %-5s [%s] ", seconds, levelName(record.level), record.category);
+                out += prefix;
+                out += message;
+                out += '\n';
+            }
+        }
+
+        // Format everything queued so far into one write; returns false if
+        // the queue was empty
+        bool drain(std::string& out, std::string& message) {
+            out.clear();
+            std::size_t drained = 0;
+            for (;;) {
+                Slot& slot = slots[dequeuePosition & (QUEUE_CAPACITY - 1)];
+                if (slot.sequence.load(std::memory_order_acquire) != dequeuePosition + 1) break;
+
+                formatRecord(out, message, slot.record);
+                slot.sequence.store(dequeuePosition + QUEUE_CAPACITY, std::memory_order_release);
+                ++dequeuePosition;
+                ++drained;
+            }
+
+            std::uint64_t dropped = droppedTotal.load(std::memory_order_relaxed);
+            if (dropped != reportedDrops) {
+                Record note{};
+                note.nanoseconds = now();
+                note.level = Level::Warning;
+                note.category = "log";
+                note.format = "queue full, {} records dropped";
+                note.argumentCount = 1;
+                note.arguments[0].type = Argument::Type::Unsigned;
+                note.arguments[0].unsignedValue = dropped - reportedDrops;
+                formatRecord(out, message, note);
+                reportedDrops = dropped;
+            }
+
+            if (!out.empty()) {
+                std::fwrite(out.data(), 1, out.size(), settings.sink);
+                std::fflush(settings.sink);
+            }
+            writtenPosition.store(dequeuePosition, std::memory_order_release);
+            return drained != 0;
+        }
+
+        void runWriter() {
+            std::string out;
+            std::string message;
+            while (running.load(std::memory_order_acquire)) {
+                currentSecond.store(now() / 1000000000, std::memory_order_relaxed);
+                if (!drain(out, message)) {
+                    std::this_thread::sleep_for(WRITER_INTERVAL);
+                }
+            }
+            drain(out, message);
+        }
+
+        struct QueueInitializer {
+            QueueInitializer() {
+                for (std::size_t i = 0; i < QUEUE_CAPACITY; ++i) {
+                    slots[i].sequence.store(i, std::memory_order_relaxed);
+                }
+            }
+        } queueInitializer;
+    }
+
+    namespace detail {
+        std::atomic<Level> minimumLevel{Level::Off};
+
+        Record* beginRecord(CallSite& site, Level level, const char* category, const char* format) {
+            std::uint32_t suppressed = 0;
+            if (!admit(site, suppressed)) return nullptr;
+
+            std::size_t position = enqueuePosition.load(std::memory_order_relaxed);
+            Slot* slot;
+            for (;;) {
+                slot = &slots[position & (QUEUE_CAPACITY - 1)];
+                std::size_t sequence = slot->sequence.load(std::memory_order_acquire);
+                std::intptr_t difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+                if (difference == 0) {
+                    if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) break;
+                } else if (difference < 0) {
+                    // The writer has fallen a full queue behind;
+                    // the held back count goes back to the site for next time
+                    site.suppressed.fetch_add(suppressed, std::memory_order_relaxed);
+                    droppedTotal.fetch_add(1, std::memory_order_relaxed);
+                    return nullptr;
+                } else {
+                    position = enqueuePosition.load(std::memory_order_relaxed);
+                }
+            }
+
+            Record& record = slot->record;
+            record.nanoseconds = now();
+            record.level = level;
+            record.argumentCount = 0;
+            record.textUsed = 0;
+            record.thread = threadIndex();
+            record.suppressed = suppressed;
+            record.category = category;
+            record.format = format;
+            return &record;
+        }
+
+        void commitRecord(Record* record) {
+            Slot* slot = reinterpret_cast<Slot*>(record);
+            std::size_t position = slot->sequence.load(std::memory_order_relaxed);
+            slot->sequence.store(position + 1, std::memory_order_release);
+        }
+
+        void copyText(Record& record, Argument& argument, std::string_view text) {
+            std::size_t length = std::min(text.size(), TEXT_BYTES - record.textUsed);
+            std::memcpy(record.text + record.textUsed, text.data(), length);
+            argument.type = Argument::Type::Copied;
+            argument.copied.offset = record.textUsed;
+            argument.copied.length = static_cast<std::uint16_t>(length);
+            record.textUsed = static_cast<std::uint16_t>(record.textUsed + length);
+        }
+    }
+
+    void start(const Options& options) {
+        if (running.exchange(true)) return;
+        settings = options;
+        perSiteLimit.store(options.perSiteLimit, std::memory_order_relaxed);
+        currentSecond.store(now() / 1000000000, std::memory_order_relaxed);
+        writer = std::thread(runWriter);
+        detail::minimumLevel.store(options.minimumLevel, std::memory_order_relaxed);
+    }
+
+    void start() {
+        start(Options());
+    }
+
+    void stop() {
+        if (!running.load(std::memory_order_acquire)) return;
+        detail::minimumLevel.store(Level::Off, std::memory_order_relaxed);
+        running.store(false, std::memory_order_release);
+        writer.join();
+    }
+
+    void flush() {
+        if (!running.load(std::memory_order_acquire)) return;
+        std::size_t target = enqueuePosition.load(std::memory_order_acquire);
+        while (writtenPosition.load(std::memory_order_acquire) < target) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    void setMinimumLevel(Level level) {
+        if (running.load(std::memory_order_acquire)) {
+            detail::minimumLevel.store(level, std::memory_order_relaxed);
+        }
+    }
+
+    std::uint64_t getSuppressedCount() {
+        return suppressedTotal.load(std::memory_order_relaxed);
+    }
+
+    std::uint64_t getDroppedCount() {
+        return droppedTotal.load(std::memory_order_relaxed);
+    }
+}
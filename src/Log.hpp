@@ -0,0 +1,178 @@
+#pragma once
+
+#include "InternedString.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+// Leveled, structured logging off the calling thread.
+// LOG_INFO("city", "{} completed {}", name, item) captures the arguments
+// into a preallocated queue slot without formatting them; a background
+// writer thread formats and prints. Levels below HEXMAP_LOG_LEVEL are
+// compiled out, arguments and all, and levels below the runtime minimum
+// cost one atomic load. Each call site prints at most a set number of
+// records per second and reports how many it held back. Nothing is
+// printed until start().
+namespace Log {
+    enum class Level : std::uint8_t {
+        Debug,
+        Info,
+        Warning,
+        Error,
+        Off
+    };
+
+    // Lowest level compiled in: 0 Debug .. 4 Off
+#if defined(HEXMAP_LOG_LEVEL)
+    constexpr Level COMPILED_LEVEL = static_cast<Level>(HEXMAP_LOG_LEVEL);
+#elif defined(NDEBUG)
+    constexpr Level COMPILED_LEVEL = Level::Info;
+#else
+    constexpr Level COMPILED_LEVEL = Level::Debug;
+#endif
+
+    enum class Format {
+        Text,       // 12.345 INFO  [city] Rome completed Granary
+        JsonLines   // {"t":12.345,"level":"info","thread":0,"category":"city","message":"..."}
+    };
+
+    constexpr std::size_t MAX_ARGUMENTS = 6;
+    constexpr std::size_t TEXT_BYTES = 192;  // Copied string arguments share this; longer ones are cut
+
+    struct Argument {
+        enum class Type : std::uint8_t {
+            Signed,
+            Unsigned,
+            Double,
+            Bool,
+            Literal,    // Points at storage that outlives the record
+            Copied      // Offset and length in Record::text
+        };
+        Type type;
+        union {
+            long long signedValue;
+            unsigned long long unsignedValue;
+            double doubleValue;
+            const char* literal;
+            struct {
+                std::uint16_t offset;
+                std::uint16_t length;
+            } copied;
+        };
+    };
+
+    struct Record {
+        std::int64_t nanoseconds;   // Since the program started
+        Level level;
+        std::uint8_t argumentCount;
+        std::uint16_t textUsed;
+        std::uint32_t thread;
+        std::uint32_t suppressed;   // Records this call site held back just before this one
+        const char* category;
+        const char* format;         // "{}" marks each argument
+        Argument arguments[MAX_ARGUMENTS];
+        char text[TEXT_BYTES];
+    };
+
+    // Per call site rate limiting state; LOG_* macros make one each
+    struct CallSite {
+        std::atomic<std::int64_t> window{-1};
+        std::atomic<std::uint32_t> count{0};
+        std::atomic<std::uint32_t> suppressed{0};
+    };
+
+    struct Options {
+        std::FILE* sink = stdout;       // Written by the writer thread only
+        Format format = Format::Text;
+        Level minimumLevel = Level::Info;
+        std::uint32_t perSiteLimit = 20;  // Records per call site per second; 0 means no limit
+    };
+
+    // Start the writer thread; logging is off until this is called
+    void start(const Options& options);
+    void start();
+    // Print what is queued, then stop the writer thread
+    void stop();
+    // Block until everything queued so far is printed
+    void flush();
+
+    void setMinimumLevel(Level level);
+
+    namespace detail {
+        extern std::atomic<Level> minimumLevel;
+
+        // Null when the queue is full; the record is counted as dropped
+        Record* beginRecord(CallSite& site, Level level, const char* category, const char* format);
+        void commitRecord(Record* record);
+
+        void copyText(Record& record, Argument& argument, std::string_view text);
+
+        template <typename T>
+        void capture(Record& record, Argument& argument, const T& value) {
+            using Value = std::decay_t<T>;
+            if constexpr (std::is_same_v<Value, bool>) {
+                argument.type = Argument::Type::Bool;
+                argument.unsignedValue = value ? 1 : 0;
+            } else if constexpr (std::is_enum_v<Value>) {
+                argument.type = Argument::Type::Signed;
+                argument.signedValue = static_cast<long long>(value);
+            } else if constexpr (std::is_integral_v<Value> && std::is_signed_v<Value>) {
+                argument.type = Argument::Type::Signed;
+                argument.signedValue = value;
+            } else if constexpr (std::is_integral_v<Value>) {
+                argument.type = Argument::Type::Unsigned;
+                argument.unsignedValue = value;
+            } else if constexpr (std::is_floating_point_v<Value>) {
+                argument.type = Argument::Type::Double;
+                argument.doubleValue = value;
+            } else if constexpr (std::is_same_v<Value, InternedString>) {
+                // Interned text is never freed, so no copy is needed
+                argument.type = Argument::Type::Literal;
+                argument.literal = value.c_str();
+            } else if constexpr (std::is_same_v<Value, const char*> || std::is_same_v<Value, char*>) {
+                // Could be a temporary buffer, so copy it
+                copyText(record, argument, value ? std::string_view(value) : std::string_view("(null)"));
+            } else {
+                copyText(record, argument, std::string_view(value));
+            }
+        }
+
+        template <typename... Args>
+        void write(CallSite& site, Level level, const char* category, const char* format, const Args&... args) {
+            static_assert(sizeof...(Args) <= MAX_ARGUMENTS, "too many log arguments");
+            Record* record = beginRecord(site, level, category, format);
+            if (!record) return;
+            std::size_t index = 0;
+            (capture(*record, record->arguments[index++], args), ...);
+            record->argumentCount = static_cast<std::uint8_t>(sizeof...(Args));
+            commitRecord(record);
+        }
+    }
+
+    inline bool isEnabled(Level level) {
+        return level >= detail::minimumLevel.load(std::memory_order_relaxed);
+    }
+
+    // Records held back by rate limits and dropped on a full queue so far
+    std::uint64_t getSuppressedCount();
+    std::uint64_t getDroppedCount();
+}
+
+#define HEXMAP_LOG(level, category, ...)                                      \
+    do {                                                                      \
+        if constexpr ((level) >= Log::COMPILED_LEVEL) {                       \
+            static Log::CallSite hexmapLogSite;                               \
+            if (Log::isEnabled(level)) {                                      \
+                Log::detail::write(hexmapLogSite, level, category, __VA_ARGS__); \
+            }                                                                 \
+        }                                                                     \
+    } while (false)
+
+#define LOG_DEBUG(category, ...) HEXMAP_LOG(Log::Level::Debug, category, __VA_ARGS__)
+#define LOG_INFO(category, ...) HEXMAP_LOG(Log::Level::Info, category, __VA_ARGS__)
+#define LOG_WARN(category, ...) HEXMAP_LOG(Log::Level::Warning, category, __VA_ARGS__)
+#define LOG_ERROR(category, ...) HEXMAP_LOG(Log::Level::Error, category, __VA_ARGS__)
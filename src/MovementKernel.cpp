@@ -0,0 +1,169 @@
+#include "MovementKernel.hpp"
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+void MovementBatch::clear() {
+    posX.clear();
+    posY.clear();
+    targetX.clear();
+    targetY.clear();
+    speed.clear();
+    moved.clear();
+    arrived.clear();
+    links.clear();
+    finished.clear();
+}
+
+void MovementBatch::add(const Link& link, const sf::Vector2f& target) {
+    posX.push_back(link.position->current.x);
+    posY.push_back(link.position->current.y);
+    targetX.push_back(target.x);
+    targetY.push_back(target.y);
+    speed.push_back(link.movement->speed);
+    // Outputs grow here too, so the kernel itself never allocates
+    moved.push_back(0.0f);
+    arrived.push_back(0);
+    links.push_back(link);
+}
+
+namespace MovementKernel {
+
+namespace {
+    // One lane; shared by the scalar path and the vector tails
+    inline void advanceLane(MovementBatch& batch, std::size_t i, float deltaTime) {
+        float dx = batch.targetX[i] - batch.posX[i];
+        float dy = batch.targetY[i] - batch.posY[i];
+        float distance = std::sqrt(dx * dx + dy * dy);
+
+        if (distance > REACH_THRESHOLD) {
+            // Move towards the waypoint without overshooting
+            float moveAmount = batch.speed[i] * deltaTime;
+            if (moveAmount > distance) {
+                moveAmount = distance;
+            }
+            batch.posX[i] += dx / distance * moveAmount;
+            batch.posY[i] += dy / distance * moveAmount;
+            batch.moved[i] = moveAmount;
+            batch.arrived[i] = 0;
+        } else {
+            // Precisely align to the waypoint
+            batch.posX[i] = batch.targetX[i];
+            batch.posY[i] = batch.targetY[i];
+            batch.moved[i] = 0.0f;
+            batch.arrived[i] = 1;
+        }
+    }
+
+    void prepareOutputs(MovementBatch& batch) {
+        batch.moved.resize(batch.size());
+        batch.arrived.resize(batch.size());
+    }
+}
+
+void advanceScalar(MovementBatch& batch, float deltaTime) {
+    prepareOutputs(batch);
+    const std::size_t count = batch.size();
+    for (std::size_t i = 0; i < count; ++i) {
+        advanceLane(batch, i, deltaTime);
+    }
+}
+
+#if defined(__SSE2__) || defined(_M_X64)
+
+void advance(MovementBatch& batch, float deltaTime) {
+    prepareOutputs(batch);
+    const std::size_t count = batch.size();
+    const __m128 dt = _mm_set1_ps(deltaTime);
+    const __m128 threshold = _mm_set1_ps(REACH_THRESHOLD);
+
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 px = _mm_loadu_ps(&batch.posX[i]);
+        __m128 py = _mm_loadu_ps(&batch.posY[i]);
+        __m128 tx = _mm_loadu_ps(&batch.targetX[i]);
+        __m128 ty = _mm_loadu_ps(&batch.targetY[i]);
+
+        __m128 dx = _mm_sub_ps(tx, px);
+        __m128 dy = _mm_sub_ps(ty, py);
+        __m128 distance = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)));
+        __m128 moveAmount = _mm_min_ps(_mm_mul_ps(_mm_loadu_ps(&batch.speed[i]), dt), distance);
+
+        __m128 nx = _mm_add_ps(px, _mm_mul_ps(_mm_div_ps(dx, distance), moveAmount));
+        __m128 ny = _mm_add_ps(py, _mm_mul_ps(_mm_div_ps(dy, distance), moveAmount));
+
+        // Lanes still short of their waypoint move, the rest snap onto it
+        __m128 far = _mm_cmpgt_ps(distance, threshold);
+        _mm_storeu_ps(&batch.posX[i], _mm_or_ps(_mm_and_ps(far, nx), _mm_andnot_ps(far, tx)));
+        _mm_storeu_ps(&batch.posY[i], _mm_or_ps(_mm_and_ps(far, ny), _mm_andnot_ps(far, ty)));
+        _mm_storeu_ps(&batch.moved[i], _mm_and_ps(far, moveAmount));
+
+        int farMask = _mm_movemask_ps(far);
+        for (int lane = 0; lane < 4; ++lane) {
+            batch.arrived[i + lane] = (farMask >> lane) & 1 ? 0 : 1;
+        }
+    }
+    for (; i < count; ++i) {
+        advanceLane(batch, i, deltaTime);
+    }
+}
+
+const char* getInstructionSet() { return "SSE2"; }
+
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+
+void advance(MovementBatch& batch, float deltaTime) {
+    prepareOutputs(batch);
+    const std::size_t count = batch.size();
+    const float32x4_t dt = vdupq_n_f32(deltaTime);
+    const float32x4_t threshold = vdupq_n_f32(REACH_THRESHOLD);
+
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        float32x4_t px = vld1q_f32(&batch.posX[i]);
+        float32x4_t py = vld1q_f32(&batch.posY[i]);
+        float32x4_t tx = vld1q_f32(&batch.targetX[i]);
+        float32x4_t ty = vld1q_f32(&batch.targetY[i]);
+
+        float32x4_t dx = vsubq_f32(tx, px);
+        float32x4_t dy = vsubq_f32(ty, py);
+        float32x4_t distance = vsqrtq_f32(vaddq_f32(vmulq_f32(dx, dx), vmulq_f32(dy, dy)));
+        float32x4_t moveAmount = vminq_f32(vmulq_f32(vld1q_f32(&batch.speed[i]), dt), distance);
+
+        float32x4_t nx = vaddq_f32(px, vmulq_f32(vdivq_f32(dx, distance), moveAmount));
+        float32x4_t ny = vaddq_f32(py, vmulq_f32(vdivq_f32(dy, distance), moveAmount));
+
+        // Lanes still short of their waypoint move, the rest snap onto it
+        uint32x4_t far = vcgtq_f32(distance, threshold);
+        vst1q_f32(&batch.posX[i], vbslq_f32(far, nx, tx));
+        vst1q_f32(&batch.posY[i], vbslq_f32(far, ny, ty));
+        vst1q_f32(&batch.moved[i], vreinterpretq_f32_u32(vandq_u32(far, vreinterpretq_u32_f32(moveAmount))));
+
+        std::uint32_t farLanes[4];
+        vst1q_u32(farLanes, far);
+        for (int lane = 0; lane < 4; ++lane) {
+            batch.arrived[i + lane] = farLanes[lane] ? 0 : 1;
+        }
+    }
+    for (; i < count; ++i) {
+        advanceLane(batch, i, deltaTime);
+    }
+}
+
+const char* getInstructionSet() { return "NEON"; }
+
+#else
+
+void advance(MovementBatch& batch, float deltaTime) {
+    advanceScalar(batch, deltaTime);
+}
+
+const char* getInstructionSet() { return "scalar"; }
+
+#endif
+
+} // namespace MovementKernel
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "Ecs.hpp"
+#include "Components.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Structure-of-arrays batch of everything moving this tick.
+// Systems::updateMovement gathers positions, current waypoints and speeds
+// into these arrays, runs the kernel over all of them at once, and writes
+// the results back. The buffers are reused from tick to tick.
+struct MovementBatch {
+    // Inputs; posX/posY are updated in place
+    std::vector<float> posX;
+    std::vector<float> posY;
+    std::vector<float> targetX;
+    std::vector<float> targetY;
+    std::vector<float> speed;
+
+    // Outputs
+    std::vector<float> moved;            // Distance covered this tick
+    std::vector<std::uint8_t> arrived;   // 1 when snapped onto the waypoint
+
+    // Where each lane came from, for writing results back
+    struct Link {
+        Entity entity;
+        Position* position;
+        Movement* movement;
+        MovementPath* path;
+    };
+    std::vector<Link> links;
+
+    // Entities whose path ended this tick
+    std::vector<Entity> finished;
+
+    void clear();
+    void add(const Link& link, const sf::Vector2f& target);
+    std::size_t size() const { return posX.size(); }
+};
+
+namespace MovementKernel {
+    // Distance below which an entity snaps onto its waypoint
+    constexpr float REACH_THRESHOLD = 1.0f;
+
+    // Reference implementation, one lane at a time
+    void advanceScalar(MovementBatch& batch, float deltaTime);
+
+    // Vectorized implementation (SSE2 or NEON, whichever the build
+    // targets), falling back to the scalar loop elsewhere. Produces the
+    // same results as advanceScalar bit for bit: it uses exact sqrt and
+    // division, never the approximate reciprocal instructions.
+    void advance(MovementBatch& batch, float deltaTime);
+
+    // Name of the instruction set advance() was compiled for
+    const char* getInstructionSet();
+}
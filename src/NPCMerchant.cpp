@@ -1,38 +1,24 @@
 #include "NPCMerchant.hpp"
+#include "Definitions.hpp"
 #include "Hero.hpp"
-#include <iostream>
+#include "Log.hpp"
+#include "World.hpp"
 
-NPCMerchant::NPCMerchant(const std::string& merchantName, const sf::Vector2f& pos, const sf::Font& font)
-    : name(merchantName), position(pos), nameText(font) {
-    
-    // Circle setup
-    shape.setRadius(15.0f);
-    shape.setOrigin(sf::Vector2f(15.0f, 15.0f));
-    shape.setPosition(position);
-    shape.setFillColor(sf::Color(160, 82, 45));
-    shape.setOutlineThickness(2.0f);
-    shape.setOutlineColor(sf::Color::Yellow);
-
-    // Text setup
-    nameText.setString(merchantName);
-    nameText.setCharacterSize(14);
-    nameText.setFillColor(sf::Color::White);
-    nameText.setOutlineColor(sf::Color::Black);
-    nameText.setOutlineThickness(1.0f);
-
-    // Center the text without using FloatRect properties
-    // Calculate an approximate width based on the character size and string length
-    float approxWidth = nameText.getString().getSize() * nameText.getCharacterSize() * 0.6f; // Estimate width
-    float approxHeight = nameText.getCharacterSize() * 1.2f; // Estimate height
-
-    nameText.setOrigin(sf::Vector2f(approxWidth / 2.f, approxHeight / 2.f));
-    nameText.setPosition(sf::Vector2f(position.x, position.y - 35.f));
+NPCMerchant::NPCMerchant(const std::string& merchantName)
+    : name(merchantName) {
+    addDefaultStock();
+}
 
+void NPCMerchant::addDefaultStock() {
     // Add units and items
-    addUnitForSale(ArmyUnit("Footman", ArmyUnitType::Infantry, 100, 10, 8, 50));
-    addUnitForSale(ArmyUnit("Archer", ArmyUnitType::Archer, 80, 15, 5, 70));
-    addItemForSale(game::InventoryItem("Health Potion", "Restores 50 health", 25));
-    addItemForSale(game::InventoryItem("Mana Potion", "Restores 30 mana", 30));
+    for (std::size_t index : Definitions::getMerchantUnits()) {
+        const Definitions::UnitDefinition& unit = Definitions::getUnit(index);
+        addUnitForSale(ArmyUnit(unit.name, unit.type, unit.health, unit.attack, unit.defense, unit.cost));
+    }
+    for (std::size_t index : Definitions::getMerchantItems()) {
+        const Definitions::ItemDefinition& item = Definitions::getItem(index);
+        addItemForSale(game::InventoryItem(item.name, item.description, item.value));
+    }
 }
 
 void NPCMerchant::addUnitForSale(const ArmyUnit& unit) {
@@ -43,29 +29,6 @@ void NPCMerchant::addItemForSale(const game::InventoryItem& item) {
     availableItems.push_back(item);
 }
 
-bool NPCMerchant::contains(const sf::Vector2f& point) const {
-    float radius = shape.getRadius() * 1.5f;
-    float dx = point.x - position.x;
-    float dy = point.y - position.y;
-    return (dx * dx + dy * dy) <= (radius * radius);
-}
-
-void NPCMerchant::draw(sf::RenderWindow& window) {
-    window.draw(shape);
-    window.draw(nameText);
-}
-
-void NPCMerchant::setFont(const sf::Font& font) {
-    nameText.setFont(font);
-
-    // Center the text without using FloatRect properties
-    float approxWidth = nameText.getString().getSize() * nameText.getCharacterSize() * 0.6f; // Estimate width
-    float approxHeight = nameText.getCharacterSize() * 1.2f; // Estimate height
-
-    nameText.setOrigin(sf::Vector2f(approxWidth / 2.f, approxHeight / 2.f));
-    nameText.setPosition(sf::Vector2f(position.x, position.y - 35.f));
-}
-
 bool NPCMerchant::sellItemTo(Hero* hero, int itemIndex) {
     if (!hero || itemIndex < 0 || itemIndex >= static_cast<int>(availableItems.size())) {
         return false;
@@ -75,7 +38,13 @@ bool NPCMerchant::sellItemTo(Hero* hero, int itemIndex) {
     
     // Check if hero has enough gold
     if (hero->getGold() < gameItem.value) {
-        std::cout << "Not enough gold to purchase " << gameItem.name << std::endl;
+        LOG_INFO("merchant", "Not enough gold to purchase {}", gameItem.name);
+        return false;
+    }
+    
+    // Check if hero has a free inventory slot
+    if (hero->isInventoryFull()) {
+        LOG_INFO("merchant", "Inventory is full");
         return false;
     }
     
@@ -86,11 +55,11 @@ bool NPCMerchant::sellItemTo(Hero* hero, int itemIndex) {
     InventoryItem heroItem(gameItem.name, gameItem.description, gameItem.value);
     hero->addItem(heroItem);
     
-    std::cout << "Purchased " << gameItem.name << " for " << gameItem.value << " gold" << std::endl;
+    LOG_INFO("merchant", "Purchased {} for {} gold", gameItem.name, gameItem.value);
     return true;
 }
 
-bool NPCMerchant::sellUnitTo(Hero* hero, int unitIndex) {
+bool NPCMerchant::sellUnitTo(Hero* hero, Army* heroArmy, int unitIndex) {
     if (!hero || unitIndex < 0 || unitIndex >= static_cast<int>(availableUnits.size())) {
         return false;
     }
@@ -99,20 +68,19 @@ bool NPCMerchant::sellUnitTo(Hero* hero, int unitIndex) {
     
     // Check if hero has enough gold
     if (hero->getGold() < unit.cost) {
-        std::cout << "Not enough gold to purchase " << unit.name << std::endl;
+        LOG_INFO("merchant", "Not enough gold to purchase {}", unit.name);
         return false;
     }
     
     // Check if hero has an army
-    Army* heroArmy = hero->getArmy();
     if (!heroArmy) {
-        std::cout << "Hero has no army to add unit to" << std::endl;
+        LOG_WARN("merchant", "Hero has no army to add unit to");
         return false;
     }
     
     // Check if army has space
     if (heroArmy->getSize() >= heroArmy->getCapacity()) {
-        std::cout << "Army is at full capacity" << std::endl;
+        LOG_INFO("merchant", "Army is at full capacity");
         return false;
     }
     
@@ -122,31 +90,30 @@ bool NPCMerchant::sellUnitTo(Hero* hero, int unitIndex) {
     // Add unit to hero's army
     heroArmy->addUnit(unit);
     
-    std::cout << "Purchased " << unit.name << " for " << unit.cost << " gold" << std::endl;
+    LOG_INFO("merchant", "Purchased {} for {} gold", unit.name, unit.cost);
     return true;
 }
 
 // MerchantManager implementation
-MerchantManager::MerchantManager() : selectedMerchant(nullptr) {
+MerchantManager::MerchantManager(World& gameWorld) : world(gameWorld) {
     // Constructor implementation
 }
 
-void MerchantManager::addMerchant(const NPCMerchant& merchant) {
-    merchants.push_back(merchant);
+Entity MerchantManager::addMerchant(const std::string& name, const sf::Vector2f& position) {
+    Entity merchant = world.create();
+    world.setPosition(merchant, position);
+    world.merchants.add(merchant, name);
+    world.addSelectable(merchant, NPCMerchant::RADIUS * 1.5f, false);
+    return merchant;
 }
 
 NPCMerchant* MerchantManager::getMerchantAt(const sf::Vector2f& position) {
-    for (auto& merchant : merchants) {
-        if (merchant.contains(position)) {
-            return &merchant;
-        }
-    }
-    return nullptr;
+    return world.merchants.get(world.pickAt(world.merchants, position));
 }
 
 bool MerchantManager::selectMerchantAt(const sf::Vector2f& position) {
-    NPCMerchant* merchant = getMerchantAt(position);
-    if (merchant) {
+    Entity merchant = world.pickAt(world.merchants, position);
+    if (merchant.isValid()) {
         selectedMerchant = merchant;
         return true;
     }
@@ -154,7 +121,19 @@ bool MerchantManager::selectMerchantAt(const sf::Vector2f& position) {
 }
 
 void MerchantManager::deselectMerchant() {
-    selectedMerchant = nullptr;
+    selectedMerchant = Entity{};
+}
+
+NPCMerchant* MerchantManager::getSelectedMerchant() const {
+    return world.merchants.get(selectedMerchant);
+}
+
+const std::vector<NPCMerchant>& MerchantManager::getMerchants() const {
+    return world.merchants.data();
+}
+
+const std::vector<Entity>& MerchantManager::getMerchantEntities() const {
+    return world.merchants.entities();
 }
 
 void MerchantManager::update(float deltaTime) {
@@ -162,15 +141,3 @@ void MerchantManager::update(float deltaTime) {
     // For now, merchants are static
     (void)deltaTime; // Avoid unused parameter warning
 }
-
-void MerchantManager::draw(sf::RenderWindow& window) {
-    for (auto& merchant : merchants) {
-        merchant.draw(window);
-    }
-}
-
-void MerchantManager::setFontForAllMerchants(const sf::Font& font) {
-    for (auto& merchant : merchants) {
-        merchant.setFont(font);
-    }
-}
\ No newline at end of file
@@ -1,24 +1,27 @@
 #pragma once
 #include "GameEntities.hpp"
 #include "Army.hpp"
-#include <SFML/Graphics.hpp>
+#include "Ecs.hpp"
+#include <SFML/System/Vector2.hpp>
 #include <vector>
 #include <string>
 
 class NPCMerchant {
 private:
     std::string name;
-    sf::Vector2f position;
     std::vector<ArmyUnit> availableUnits;
     std::vector<game::InventoryItem> availableItems;
-    sf::CircleShape shape;
-    sf::Text nameText;
+
+    // Stock every merchant starts with
+    void addDefaultStock();
 
 public:
-    NPCMerchant(const std::string& merchantName, const sf::Vector2f& pos, const sf::Font& font);
+    // Radius of the drawn merchant marker; the pick radius is derived from it
+    static constexpr float RADIUS = 15.0f;
+
+    explicit NPCMerchant(const std::string& merchantName);
 
     const std::string& getName() const { return name; }
-    const sf::Vector2f& getPosition() const { return position; }
 
     void addUnitForSale(const ArmyUnit& unit);
     void addItemForSale(const game::InventoryItem& item);
@@ -26,25 +29,23 @@ public:
     const std::vector<ArmyUnit>& getAvailableUnits() const { return availableUnits; }
     const std::vector<game::InventoryItem>& getAvailableItems() const { return availableItems; }
 
-    bool sellUnitTo(Hero* hero, int unitIndex);
+    bool sellUnitTo(Hero* hero, Army* heroArmy, int unitIndex);
     bool sellItemTo(Hero* hero, int itemIndex);
-
-    bool contains(const sf::Vector2f& point) const;
-    void draw(sf::RenderWindow& window);
-    void setFont(const sf::Font& font);
 };
 
-// Manager class to handle multiple merchants
+class World;
+
+// Facade over the merchant entities in the World
 class MerchantManager {
 private:
-    std::vector<NPCMerchant> merchants;
-    NPCMerchant* selectedMerchant;
+    World& world;
+    Entity selectedMerchant;
     
 public:
-    MerchantManager();
+    explicit MerchantManager(World& world);
     
     // Add a new merchant
-    void addMerchant(const NPCMerchant& merchant);
+    Entity addMerchant(const std::string& name, const sf::Vector2f& position);
     
     // Check if a merchant is at a position
     NPCMerchant* getMerchantAt(const sf::Vector2f& position);
@@ -52,12 +53,13 @@ public:
     // Selection management
     bool selectMerchantAt(const sf::Vector2f& position);
     void deselectMerchant();
-    NPCMerchant* getSelectedMerchant() const { return selectedMerchant; }
+    NPCMerchant* getSelectedMerchant() const;
+    
+    // Read-only dense access for snapshot building;
+    // getMerchantEntities()[i] owns getMerchants()[i]
+    const std::vector<NPCMerchant>& getMerchants() const;
+    const std::vector<Entity>& getMerchantEntities() const;
     
     // Update and draw merchants
     void update(float deltaTime);
-    void draw(sf::RenderWindow& window);
-    
-    // Set font for all merchants
-    void setFontForAllMerchants(const sf::Font& font);
 };
\ No newline at end of file
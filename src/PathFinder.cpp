@@ -1,6 +1,7 @@
 #include "PathFinder.hpp"
+#include "Definitions.hpp"
+#include "Log.hpp"
 #include <cmath>
-#include <iostream>
 #include <algorithm>
 #include <unordered_set>
 #include <queue>
@@ -29,17 +30,16 @@ bool PathFinder::isWalkableTile(const std::vector<std::vector<Tile>>& tileMap, c
         return false;
     }
     
-    TileType tileType = tileMap[pos.x][pos.y].type;
-    return tileType != TileType::Water && 
-           tileType != TileType::Mountain;
+    return Definitions::getTerrain(tileMap[pos.x][pos.y].type).walkable;
 }
 
 // Get valid neighboring tiles
-std::vector<sf::Vector2i> PathFinder::getWalkableNeighbors(
+void PathFinder::getWalkableNeighbors(
     const std::vector<std::vector<Tile>>& tileMap,
-    const sf::Vector2i& current) {
+    const sf::Vector2i& current,
+    std::pmr::vector<sf::Vector2i>& walkableNeighbors) {
     
-    std::vector<sf::Vector2i> walkableNeighbors;
+    walkableNeighbors.clear();
     bool isEvenCol = current.x % 2 == 0;
     
     // Select appropriate neighbor offsets based on column parity
@@ -53,8 +53,6 @@ std::vector<sf::Vector2i> PathFinder::getWalkableNeighbors(
             walkableNeighbors.push_back(neighbor);
         }
     }
-    
-    return walkableNeighbors;
 }
 
 // Calculate movement cost based on tile type
@@ -64,33 +62,29 @@ float PathFinder::getMovementCost(const std::vector<std::vector<Tile>>& tileMap,
         return std::numeric_limits<float>::max();
     }
     
-    TileType tileType = tileMap[pos.x][pos.y].type;
-    switch (tileType) {
-        case TileType::Plains: return 1.0f;
-        case TileType::Forest: return 1.5f;
-        case TileType::Hills: return 2.0f;
-        case TileType::Water: return std::numeric_limits<float>::max();
-        case TileType::Mountain: return std::numeric_limits<float>::max();
-        default: return 1.0f;
-    }
+    return Definitions::getTerrain(tileMap[pos.x][pos.y].type).pathCost;
 }
 
 std::vector<sf::Vector2f> PathFinder::findPath(
     const std::vector<std::vector<Tile>>& tileMap,
     const sf::Vector2i& start,
     const sf::Vector2i& goal,
-    int maxMovementPoints) {
+    int maxMovementPoints,
+    std::pmr::memory_resource* scratch) {
     
     // Validate start and goal
     if (!isWalkableTile(tileMap, start) || !isWalkableTile(tileMap, goal)) {
-        std::cout << "Invalid start or goal tile" << std::endl;
+        LOG_DEBUG("path", "Invalid start or goal tile");
         return {};
     }
     
-    // A* algorithm with hex grid specifics
-    std::priority_queue<PathNode, std::vector<PathNode>, std::greater<PathNode>> openSet;
-    std::unordered_map<int, PathNode> allNodes;
-    std::unordered_set<int> closedSet;
+    // A* algorithm with hex grid specifics; all search state lives in scratch
+    std::priority_queue<PathNode, std::pmr::vector<PathNode>, std::greater<PathNode>> openSet{
+        std::greater<PathNode>(), std::pmr::vector<PathNode>(scratch)};
+    std::pmr::unordered_map<int, PathNode> allNodes(scratch);
+    std::pmr::unordered_set<int> closedSet(scratch);
+    std::pmr::vector<sf::Vector2i> neighbors(scratch);
+    neighbors.reserve(6);
     
     // Hash function for tile coordinates
     auto coordToKey = [](const sf::Vector2i& pos) {
@@ -114,14 +108,15 @@ std::vector<sf::Vector2f> PathFinder::findPath(
         
         // Check if goal reached
         if (current.pos == goal) {
-            return reconstructPath(tileMap, allNodes, coordToKey, start, goal);
+            return reconstructPath(tileMap, allNodes, coordToKey, start, goal, scratch);
         }
         
         // Mark as closed
         closedSet.insert(coordToKey(current.pos));
         
         // Explore neighbors
-        for (const auto& neighborPos : getWalkableNeighbors(tileMap, current.pos)) {
+        getWalkableNeighbors(tileMap, current.pos, neighbors);
+        for (const auto& neighborPos : neighbors) {
             int neighborKey = coordToKey(neighborPos);
             
             // Skip if already closed
@@ -152,18 +147,19 @@ std::vector<sf::Vector2f> PathFinder::findPath(
     }
     
     // No path found
-    std::cout << "No path found between tiles" << std::endl;
+    LOG_DEBUG("path", "No path found between tiles");
     return {};
 }
 
 std::vector<sf::Vector2f> PathFinder::reconstructPath(
     const std::vector<std::vector<Tile>>& tileMap,
-    const std::unordered_map<int, PathNode>& nodes,
+    const std::pmr::unordered_map<int, PathNode>& nodes,
     std::function<int(const sf::Vector2i&)> coordToKey,
     const sf::Vector2i& start,
-    const sf::Vector2i& goal) {
+    const sf::Vector2i& goal,
+    std::pmr::memory_resource* scratch) {
     
-    std::vector<sf::Vector2i> tilePath;
+    std::pmr::vector<sf::Vector2i> tilePath(scratch);
     sf::Vector2i current = goal;
     
     // Reconstruct path by tracking parents
@@ -182,6 +178,7 @@ std::vector<sf::Vector2f> PathFinder::reconstructPath(
     
     // Expand path to include intermediate tile centers
     std::vector<sf::Vector2f> worldPath;
+    worldPath.reserve(tilePath.size() * 2 - 1);
     
     // Add start point
     worldPath.push_back(tileMap[tilePath[0].x][tilePath[0].y].center);
@@ -1,12 +1,13 @@
 #pragma once
 
-#include "Tile.hpp"
+#include "GameEntities.hpp"
 #include <SFML/System/Vector2.hpp>
 #include <vector>
 #include <queue>
 #include <unordered_map>
 #include <functional>
 #include <limits>
+#include <memory_resource>
 
 namespace game {
 
@@ -25,12 +26,15 @@ struct PathNode {
 
 class PathFinder {
 public:
-    // Main pathfinding function
+    // Main pathfinding function. The search's open list, node map and
+    // neighbor lists come from scratch (e.g. a FrameArena); only the
+    // returned path uses the global allocator.
     static std::vector<sf::Vector2f> findPath(
         const std::vector<std::vector<Tile>>& tileMap,
         const sf::Vector2i& start,
         const sf::Vector2i& goal,
-        int maxMovementPoints);
+        int maxMovementPoints,
+        std::pmr::memory_resource* scratch = std::pmr::get_default_resource());
 
 private:
     // Heuristic function for hex grid distance
@@ -41,10 +45,11 @@ private:
         const std::vector<std::vector<Tile>>& tileMap, 
         const sf::Vector2i& pos);
     
-    // Get valid neighboring tiles
-    static std::vector<sf::Vector2i> getWalkableNeighbors(
+    // Replace neighbors with the valid neighboring tiles
+    static void getWalkableNeighbors(
         const std::vector<std::vector<Tile>>& tileMap,
-        const sf::Vector2i& current);
+        const sf::Vector2i& current,
+        std::pmr::vector<sf::Vector2i>& neighbors);
     
     // Calculate movement cost for a tile
     static float getMovementCost(
@@ -54,10 +59,11 @@ private:
     // Reconstruct path from A* algorithm results
     static std::vector<sf::Vector2f> reconstructPath(
         const std::vector<std::vector<Tile>>& tileMap,
-        const std::unordered_map<int, PathNode>& nodes,
+        const std::pmr::unordered_map<int, PathNode>& nodes,
         std::function<int(const sf::Vector2i&)> coordToKey,
         const sf::Vector2i& start,
-        const sf::Vector2i& goal);
+        const sf::Vector2i& goal,
+        std::pmr::memory_resource* scratch);
 };
 
 } // namespace game
\ No newline at end of file
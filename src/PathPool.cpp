@@ -0,0 +1,76 @@
+#include "PathPool.hpp"
+#include <algorithm>
+
+PathPool::PathPool()
+    : freeList(MovementPath::NO_BLOCK), freeCount(0) {
+}
+
+std::uint32_t PathPool::takeBlock() {
+    if (freeList != MovementPath::NO_BLOCK) {
+        std::uint32_t index = freeList;
+        freeList = blocks[index].next;
+        --freeCount;
+        return index;
+    }
+    blocks.emplace_back();
+    return static_cast<std::uint32_t>(blocks.size() - 1);
+}
+
+void PathPool::assign(MovementPath& path, const sf::Vector2f* waypoints, std::size_t count) {
+    release(path);
+
+    // Chain blocks front to back, filling each before taking the next
+    std::uint32_t previous = MovementPath::NO_BLOCK;
+    for (std::size_t offset = 0; offset < count; offset += WAYPOINTS_PER_BLOCK) {
+        std::uint32_t index = takeBlock();
+        std::size_t filled = std::min(WAYPOINTS_PER_BLOCK, count - offset);
+        std::copy(waypoints + offset, waypoints + offset + filled, blocks[index].waypoints);
+        blocks[index].next = MovementPath::NO_BLOCK;
+
+        if (previous == MovementPath::NO_BLOCK) {
+            path.head = index;
+        } else {
+            blocks[previous].next = index;
+        }
+        previous = index;
+    }
+
+    path.cursor = path.head;
+    path.count = static_cast<std::uint32_t>(count);
+    path.next = 0;
+}
+
+void PathPool::release(MovementPath& path) {
+    std::uint32_t index = path.head;
+    while (index != MovementPath::NO_BLOCK) {
+        std::uint32_t following = blocks[index].next;
+        blocks[index].next = freeList;
+        freeList = index;
+        ++freeCount;
+        index = following;
+    }
+    path = MovementPath{};
+}
+
+bool PathPool::advance(MovementPath& path) const {
+    if (++path.next >= path.count) return false;
+    if (path.next % WAYPOINTS_PER_BLOCK == 0) {
+        path.cursor = blocks[path.cursor].next;
+    }
+    return true;
+}
+
+void PathPool::copyWaypoints(const MovementPath& path, std::size_t first, std::vector<sf::Vector2f>& out) const {
+    out.clear();
+    if (first >= path.count) return;
+    out.reserve(path.count - first);
+
+    std::uint32_t index = path.head;
+    for (std::size_t offset = 0; index != MovementPath::NO_BLOCK; offset += WAYPOINTS_PER_BLOCK) {
+        const Block& block = blocks[index];
+        std::size_t end = std::min<std::size_t>(WAYPOINTS_PER_BLOCK, path.count - offset);
+        std::size_t begin = first > offset ? std::min(first - offset, end) : 0;
+        out.insert(out.end(), block.waypoints + begin, block.waypoints + end);
+        index = block.next;
+    }
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "Components.hpp"
+#include <SFML/System/Vector2.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Waypoint storage for every MovementPath in a World.
+// A path is a chain of fixed-size blocks taken from one shared array; a
+// finished path returns its blocks to a free list, so once the pool has
+// grown to the busiest moment, ordering and finishing moves allocates
+// nothing. Each block is two cache lines. Paths are read through a cursor
+// on the block holding the waypoint being approached, so following one is
+// O(1) per waypoint.
+class PathPool {
+public:
+    static constexpr std::size_t WAYPOINTS_PER_BLOCK = 15;
+
+    struct alignas(64) Block {
+        sf::Vector2f waypoints[WAYPOINTS_PER_BLOCK];
+        std::uint32_t next;  // Following block of the path, or MovementPath::NO_BLOCK
+    };
+
+private:
+    std::vector<Block> blocks;
+    std::uint32_t freeList;
+    std::size_t freeCount;
+
+    std::uint32_t takeBlock();
+
+public:
+    PathPool();
+
+    // Store waypoints as path's route, releasing whatever it held before
+    void assign(MovementPath& path, const sf::Vector2f* waypoints, std::size_t count);
+    void assign(MovementPath& path, const std::vector<sf::Vector2f>& waypoints) {
+        assign(path, waypoints.data(), waypoints.size());
+    }
+
+    // Give the path's blocks back; the path is left empty
+    void release(MovementPath& path);
+
+    // Waypoint being approached; only valid while path.next < path.count
+    const sf::Vector2f& current(const MovementPath& path) const {
+        return blocks[path.cursor].waypoints[path.next % WAYPOINTS_PER_BLOCK];
+    }
+
+    // Move on to the next waypoint; false once the path is done
+    bool advance(MovementPath& path) const;
+
+    // Replace out with the waypoints from index first to the end
+    void copyWaypoints(const MovementPath& path, std::size_t first, std::vector<sf::Vector2f>& out) const;
+
+    std::size_t getBlockCount() const { return blocks.size(); }
+    std::size_t getFreeBlockCount() const { return freeCount; }
+};
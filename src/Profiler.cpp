@@ -0,0 +1,281 @@
+#include "Profiler.hpp"
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <limits>
+
+namespace {
+    std::uint64_t packSample(const Profiler::Sample& sample) {
+        return static_cast<std::uint64_t>(sample.durationNanoseconds) << 32 |
+               static_cast<std::uint64_t>(sample.scope) << 16 |
+               sample.depth;
+    }
+
+    std::uint64_t packAllocations(const Profiler::Sample& sample) {
+        return static_cast<std::uint64_t>(sample.allocations) << 32 | sample.allocatedBytes;
+    }
+
+    Profiler::Sample unpackSample(std::uint64_t start, std::uint64_t packed, std::uint64_t allocations) {
+        Profiler::Sample sample;
+        sample.startNanoseconds = start;
+        sample.durationNanoseconds = static_cast<std::uint32_t>(packed >> 32);
+        sample.scope = static_cast<Profiler::ScopeId>(packed >> 16);
+        sample.depth = static_cast<std::uint16_t>(packed);
+        sample.allocations = static_cast<std::uint32_t>(allocations >> 32);
+        sample.allocatedBytes = static_cast<std::uint32_t>(allocations);
+        return sample;
+    }
+
+    std::uint32_t clampToWord(std::uint64_t value) {
+        return static_cast<std::uint32_t>(std::min<std::uint64_t>(value, std::numeric_limits<std::uint32_t>::max()));
+    }
+
+    // Scope and track names are ours, but keep the JSON valid regardless
+    std::string escapeJson(const std::string& text) {
+        std::string escaped;
+        for (char c : text) {
+            if (c == '"' || c == '\\') {
+                escaped += '\\';
+            }
+            escaped += c;
+        }
+        return escaped;
+    }
+}
+
+Profiler::Track::Track(const std::string& trackName, Clock::time_point start)
+    : name(trackName),
+      epoch(start),
+      slots(new std::atomic<std::uint64_t>[CAPACITY * WORDS_PER_SAMPLE]),
+      written(0),
+      depth(0),
+      read(0),
+      frames(FRAME_HISTORY),
+      frameCount(0)
+{
+    for (std::size_t i = 0; i < CAPACITY * WORDS_PER_SAMPLE; ++i) {
+        slots[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+void Profiler::Track::push(const Sample& sample) {
+    std::uint64_t index = written.load(std::memory_order_relaxed);
+
+    // Pairs with the fence in collect(): a reader that sees these stores also
+    // sees the count from before them, so it can tell the slot was reused
+    std::atomic_thread_fence(std::memory_order_release);
+    std::size_t slot = (index & (CAPACITY - 1)) * WORDS_PER_SAMPLE;
+    slots[slot].store(sample.startNanoseconds, std::memory_order_relaxed);
+    slots[slot + 1].store(packSample(sample), std::memory_order_relaxed);
+    slots[slot + 2].store(packAllocations(sample), std::memory_order_relaxed);
+    written.store(index + 1, std::memory_order_release);
+}
+
+void ProfileScope::stop() {
+    if (!track) return;
+
+    auto end = Profiler::Clock::now();
+    AllocationTracker::Counters endAllocations = AllocationTracker::getThreadCounters();
+    auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    auto since = std::chrono::duration_cast<std::chrono::nanoseconds>(start - track->epoch).count();
+
+    Profiler::Sample sample;
+    sample.startNanoseconds = static_cast<std::uint64_t>(since);
+    sample.durationNanoseconds = static_cast<std::uint32_t>(
+        std::min<long long>(nanoseconds, std::numeric_limits<std::uint32_t>::max()));
+    sample.scope = scope;
+    sample.depth = depth;
+    sample.allocations = clampToWord(endAllocations.allocations - startAllocations.allocations);
+    sample.allocatedBytes = clampToWord(endAllocations.bytes - startAllocations.bytes);
+
+    --track->depth;
+    track->push(sample);
+    track = nullptr;
+}
+
+Profiler::Profiler()
+    : epoch(Clock::now()),
+      droppedSamples(0),
+      capturing(false)
+{
+}
+
+Profiler::Track* Profiler::addTrack(const std::string& name) {
+    tracks.push_back(std::make_unique<Track>(name, epoch));
+    return tracks.back().get();
+}
+
+Profiler::ScopeId Profiler::addScope(const std::string& name) {
+    for (std::size_t i = 0; i < scopes.size(); ++i) {
+        if (scopes[i].name == name) return static_cast<ScopeId>(i);
+    }
+
+    ScopeHistory history;
+    history.name = name;
+    history.milliseconds.assign(SCOPE_HISTORY, 0.0f);
+    history.allocations.assign(SCOPE_HISTORY, 0);
+    history.bytes.assign(SCOPE_HISTORY, 0);
+    scopes.push_back(std::move(history));
+    return static_cast<ScopeId>(scopes.size() - 1);
+}
+
+void Profiler::setAllocationBudget(ScopeId scope, std::size_t allocations) {
+    scopes[scope].allocationBudget = static_cast<long long>(allocations);
+}
+
+void Profiler::collect() {
+    for (std::size_t trackIndex = 0; trackIndex < tracks.size(); ++trackIndex) {
+        Track& track = *tracks[trackIndex];
+        std::uint64_t end = track.written.load(std::memory_order_acquire);
+
+        // The recorder may have lapped us; skip what was overwritten
+        if (end - track.read > Track::CAPACITY) {
+            droppedSamples += end - track.read - Track::CAPACITY;
+            track.read = end - Track::CAPACITY;
+        }
+
+        for (; track.read < end; ++track.read) {
+            std::size_t slot = (track.read & (Track::CAPACITY - 1)) * Track::WORDS_PER_SAMPLE;
+            std::uint64_t start = track.slots[slot].load(std::memory_order_relaxed);
+            std::uint64_t packed = track.slots[slot + 1].load(std::memory_order_relaxed);
+            std::uint64_t allocations = track.slots[slot + 2].load(std::memory_order_relaxed);
+
+            // Overwritten, or being overwritten, while we were reading it
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (track.written.load(std::memory_order_relaxed) - track.read >= Track::CAPACITY) {
+                ++droppedSamples;
+                continue;
+            }
+
+            Sample sample = unpackSample(start, packed, allocations);
+            if (sample.scope >= scopes.size()) continue;
+
+            float milliseconds = sample.durationNanoseconds / 1.0e6f;
+            ScopeHistory& history = scopes[sample.scope];
+            std::size_t at = history.count % SCOPE_HISTORY;
+            history.milliseconds[at] = milliseconds;
+            history.allocations[at] = sample.allocations;
+            history.bytes[at] = sample.allocatedBytes;
+            history.last = milliseconds;
+            ++history.count;
+            if (history.allocationBudget >= 0 && sample.allocations > history.allocationBudget) {
+                ++history.overBudget;
+            }
+
+            // Inner scopes end before the one around them, so a frame's parts
+            // are all in by the time its outermost scope arrives
+            if (sample.depth == 1) {
+                track.openParts.emplace_back(sample.scope, milliseconds);
+            } else if (sample.depth == 0) {
+                FrameRecord& frame = track.frames[track.frameCount % FRAME_HISTORY];
+                frame.milliseconds = milliseconds;
+                frame.parts.swap(track.openParts);
+                track.openParts.clear();
+                ++track.frameCount;
+            }
+
+            if (capturing && captured.size() < MAX_CAPTURED) {
+                captured.emplace_back(static_cast<std::uint16_t>(trackIndex), sample);
+            }
+        }
+    }
+}
+
+std::vector<Profiler::ScopeStats> Profiler::getScopeStats() const {
+    std::vector<ScopeStats> stats;
+    getScopeStats(stats);
+    return stats;
+}
+
+void Profiler::getScopeStats(std::vector<ScopeStats>& stats) const {
+    stats.resize(scopes.size());
+    std::array<float, SCOPE_HISTORY> sorted;
+    for (std::size_t s = 0; s < scopes.size(); ++s) {
+        const auto& history = scopes[s];
+        ScopeStats& scope = stats[s];
+        scope.name = history.name;
+        scope.samples = history.count;
+        scope.lastMilliseconds = history.last;
+        scope.hasBudget = history.allocationBudget >= 0;
+        scope.overBudget = history.overBudget;
+
+        std::size_t kept = std::min(history.count, SCOPE_HISTORY);
+        if (kept > 0) {
+            std::copy(history.milliseconds.begin(), history.milliseconds.begin() + kept, sorted.begin());
+            std::sort(sorted.begin(), sorted.begin() + kept);
+            scope.p50Milliseconds = sorted[kept / 2];
+            scope.p99Milliseconds = sorted[std::min(kept - 1, kept * 99 / 100)];
+
+            double allocations = 0.0;
+            double bytes = 0.0;
+            for (std::size_t i = 0; i < kept; ++i) {
+                allocations += history.allocations[i];
+                bytes += history.bytes[i];
+            }
+            scope.averageAllocations = allocations / kept;
+            scope.averageBytes = bytes / kept;
+        } else {
+            scope.p50Milliseconds = scope.p99Milliseconds = 0.0;
+            scope.averageAllocations = scope.averageBytes = 0.0;
+        }
+    }
+}
+
+std::vector<Profiler::FrameRecord> Profiler::getFrames(const Track* track) const {
+    std::vector<FrameRecord> frames;
+    getFrames(track, frames);
+    return frames;
+}
+
+void Profiler::getFrames(const Track* track, std::vector<FrameRecord>& frames) const {
+    if (!track) {
+        frames.clear();
+        return;
+    }
+
+    // Assigning over existing records keeps their part vectors' capacity
+    std::size_t kept = std::min(track->frameCount, FRAME_HISTORY);
+    frames.resize(kept);
+    for (std::size_t i = 0; i < kept; ++i) {
+        frames[i] = track->frames[(track->frameCount - kept + i) % FRAME_HISTORY];
+    }
+}
+
+void Profiler::startCapture() {
+    captured.clear();
+    capturing = true;
+}
+
+bool Profiler::writeChromeTrace(const std::string& path) const {
+    std::ofstream file(path);
+    if (!file) return false;
+
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+    // Thread names first so the viewer labels the rows
+    const char* separator = "";
+    for (std::size_t i = 0; i < tracks.size(); ++i) {
+        file << separator << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << i
+             << ",\"args\":{\"name\":\"" << escapeJson(tracks[i]->getName()) << "\"}}";
+        separator = ",\n";
+    }
+
+    // Complete events; timestamps are in microseconds
+    file.setf(std::ios::fixed);
+    file.precision(3);
+    for (std::size_t i = 0; i < captured.size(); ++i) {
+        const Sample& sample = captured[i].second;
+        file << separator << "{\"name\":\"" << escapeJson(scopes[sample.scope].name) << "\",\"ph\":\"X\",\"pid\":1,\"tid\":"
+             << captured[i].first
+             << ",\"ts\":" << sample.startNanoseconds / 1000.0
+             << ",\"dur\":" << sample.durationNanoseconds / 1000.0;
+        if (sample.allocations > 0) {
+            file << ",\"args\":{\"allocations\":" << sample.allocations << ",\"bytes\":" << sample.allocatedBytes << "}";
+        }
+        file << "}";
+        separator = ",\n";
+    }
+
+    file << "\n]}\n";
+    return static_cast<bool>(file);
+}
@@ -0,0 +1,181 @@
+#pragma once
+
+#include "AllocationTracker.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Frame profiler built from scoped timers.
+// Every thread that records owns a Track: a fixed ring of samples that only
+// that thread writes and only collect() reads, so timing a scope never takes
+// a lock. collect() runs once per frame on the main thread and keeps
+// per-scope percentiles, a short history of frames split by their top-level
+// scopes for the overlay, and, while capturing, every sample for a Chrome
+// trace (chrome://tracing or Perfetto). With allocation tracking built in,
+// samples also carry what the scope allocated, and scopes can be given an
+// allocation budget.
+// Register tracks and scopes before the recording threads start.
+class Profiler {
+public:
+    using ScopeId = std::uint16_t;
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr std::size_t SCOPE_HISTORY = 240;  // Samples kept per scope for percentiles
+    static constexpr std::size_t FRAME_HISTORY = 120;  // Frames kept per track for the chart
+
+    struct Sample {
+        std::uint64_t startNanoseconds = 0;     // Since the profiler was created
+        std::uint32_t durationNanoseconds = 0;
+        ScopeId scope = 0;
+        std::uint16_t depth = 0;                // 0 for a track's outermost scope
+        std::uint32_t allocations = 0;          // Heap allocations inside the scope
+        std::uint32_t allocatedBytes = 0;
+    };
+
+    // One outermost scope and the time spent in each scope directly inside it
+    struct FrameRecord {
+        double milliseconds = 0.0;
+        std::vector<std::pair<ScopeId, double>> parts;
+    };
+
+    struct ScopeStats {
+        std::string name;
+        std::size_t samples = 0;
+        double lastMilliseconds = 0.0;
+        double p50Milliseconds = 0.0;
+        double p99Milliseconds = 0.0;
+        double averageAllocations = 0.0;        // Per sample, over the kept samples
+        double averageBytes = 0.0;
+        bool hasBudget = false;
+        std::size_t overBudget = 0;             // Samples that allocated more than the budget
+    };
+
+    class Track {
+    private:
+        friend class Profiler;
+        friend class ProfileScope;
+
+        static constexpr std::size_t CAPACITY = 1 << 14;  // Samples; a power of two
+
+        std::string name;
+        Clock::time_point epoch;
+
+        static constexpr std::size_t WORDS_PER_SAMPLE = 3;
+
+        // Whole words per sample, so a lapped read is detected instead of torn
+        std::unique_ptr<std::atomic<std::uint64_t>[]> slots;
+        std::atomic<std::uint64_t> written;
+
+        // Recording thread only
+        std::uint16_t depth;
+
+        // collect() only
+        std::uint64_t read;
+        std::vector<std::pair<ScopeId, double>> openParts;
+        std::vector<FrameRecord> frames;  // Ring of FRAME_HISTORY
+        std::size_t frameCount;
+
+        void push(const Sample& sample);
+
+    public:
+        Track(const std::string& name, Clock::time_point epoch);
+
+        const std::string& getName() const { return name; }
+    };
+
+private:
+    struct ScopeHistory {
+        std::string name;
+        std::vector<float> milliseconds;  // Ring of SCOPE_HISTORY
+        std::vector<std::uint32_t> allocations;
+        std::vector<std::uint32_t> bytes;
+        std::size_t count = 0;
+        float last = 0.0f;
+        long long allocationBudget = -1;  // Per sample; negative for none
+        std::size_t overBudget = 0;
+    };
+
+    Clock::time_point epoch;
+    std::vector<std::unique_ptr<Track>> tracks;
+    std::vector<ScopeHistory> scopes;
+    std::size_t droppedSamples;
+
+    // Chrome trace capture; bounded so a forgotten capture cannot eat memory
+    static constexpr std::size_t MAX_CAPTURED = 1 << 21;
+    bool capturing;
+    std::vector<std::pair<std::uint16_t, Sample>> captured;  // Track index, sample
+
+public:
+    Profiler();
+
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+    // A ring for one recording thread; the pointer stays valid for the
+    // profiler's lifetime
+    Track* addTrack(const std::string& name);
+
+    // Returns the existing id when the name is already registered
+    ScopeId addScope(const std::string& name);
+    const std::string& getScopeName(ScopeId scope) const { return scopes[scope].name; }
+
+    // Count samples of scope that allocate more than allocations times
+    void setAllocationBudget(ScopeId scope, std::size_t allocations);
+
+    // Drain every track; call once per frame from the main thread
+    void collect();
+
+    // Percentiles over each scope's recent samples, in registration order
+    std::vector<ScopeStats> getScopeStats() const;
+    // Same, into stats; reuses its storage, so a warm vector does not allocate
+    void getScopeStats(std::vector<ScopeStats>& stats) const;
+
+    // Recent frames of a track, oldest first
+    std::vector<FrameRecord> getFrames(const Track* track) const;
+    // Same, into frames; reuses its storage, so a warm vector does not allocate
+    void getFrames(const Track* track, std::vector<FrameRecord>& frames) const;
+
+    // Samples overwritten before collect() got to them
+    std::size_t getDroppedSamples() const { return droppedSamples; }
+
+    void startCapture();
+    void stopCapture() { capturing = false; }
+    bool isCapturing() const { return capturing; }
+    std::size_t getCapturedCount() const { return captured.size(); }
+
+    // Write the captured samples as Chrome trace event JSON
+    bool writeChromeTrace(const std::string& path) const;
+};
+
+// Times its enclosing block into a track; does nothing without one.
+// stop() ends the measurement early for blocks that are not their own scope.
+class ProfileScope {
+private:
+    Profiler::Track* track;
+    Profiler::ScopeId scope;
+    std::uint16_t depth;
+    Profiler::Clock::time_point start;
+    AllocationTracker::Counters startAllocations;
+
+public:
+    ProfileScope(Profiler::Track* profileTrack, Profiler::ScopeId scopeId)
+        : track(profileTrack), scope(scopeId), depth(0) {
+        if (track) {
+            depth = track->depth++;
+            startAllocations = AllocationTracker::getThreadCounters();
+            start = Profiler::Clock::now();
+        }
+    }
+
+    ~ProfileScope() { stop(); }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+    void stop();
+};
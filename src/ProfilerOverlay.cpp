@@ -0,0 +1,163 @@
+#include "ProfilerOverlay.hpp"
+#include <algorithm>
+#include <cstdio>
+
+namespace {
+    const float PANEL_WIDTH = 380.0f;
+    const float CHART_HEIGHT = 90.0f;
+    const float CHART_MILLISECONDS = 33.3f;  // Full chart height; bars past it are clipped
+    const float FRAME_BUDGET = 1000.0f / 60.0f;
+    const float MARGIN = 8.0f;
+
+    // Scope colors, picked by scope id; grey is time outside any inner scope
+    const sf::Color SCOPE_COLORS[] = {
+        sf::Color(230, 110, 30), sf::Color(40, 150, 220), sf::Color(120, 200, 60),
+        sf::Color(200, 60, 160), sf::Color(240, 200, 40), sf::Color(90, 90, 230),
+        sf::Color(40, 190, 170), sf::Color(220, 60, 60)
+    };
+    const sf::Color UNTRACKED_COLOR(110, 110, 110);
+
+    sf::Color scopeColor(Profiler::ScopeId scope) {
+        return SCOPE_COLORS[scope % (sizeof(SCOPE_COLORS) / sizeof(SCOPE_COLORS[0]))];
+    }
+
+    // printf into a reused string; the overlay's lines are short
+    template <typename... Args>
+    void appendFormat(std::string& out, const char* format, Args... args) {
+        char line[128];
+        std::snprintf(line, sizeof(line), format, args...);
+        out += line;
+    }
+
+    void appendQuad(sf::VertexArray& vertices, float left, float top, float width, float height, sf::Color color) {
+        sf::Vector2f a(left, top), b(left + width, top), c(left + width, top + height), d(left, top + height);
+        vertices.append(sf::Vertex{a, color});
+        vertices.append(sf::Vertex{b, color});
+        vertices.append(sf::Vertex{c, color});
+        vertices.append(sf::Vertex{a, color});
+        vertices.append(sf::Vertex{c, color});
+        vertices.append(sf::Vertex{d, color});
+    }
+}
+
+ProfilerOverlay::ProfilerOverlay(const Profiler& source, const Profiler::Track* chartTrack, const sf::Font& font)
+    : profiler(source),
+      track(chartTrack),
+      visible(false),
+      bars(sf::PrimitiveType::Triangles),
+      budgetLine(sf::PrimitiveType::Lines),
+      legend(font, "", 11),
+      table(font, "", 12) {
+    background.setFillColor(sf::Color(0, 0, 0, 190));
+    background.setOutlineColor(sf::Color(200, 200, 200, 120));
+    background.setOutlineThickness(1.0f);
+    legend.setString("frames of " + (track ? track->getName() : std::string("-")) + ", line = 16.7 ms");
+    legend.setFillColor(sf::Color::White);
+    table.setFillColor(sf::Color::White);
+}
+
+void ProfilerOverlay::buildBars(const sf::Vector2f& origin) {
+    bars.clear();
+    budgetLine.clear();
+
+    profiler.getFrames(track, frames);
+    const float barWidth = PANEL_WIDTH / Profiler::FRAME_HISTORY;
+    const float scale = CHART_HEIGHT / CHART_MILLISECONDS;
+    const float bottom = origin.y + CHART_HEIGHT;
+
+    // Newest frame on the right
+    float left = origin.x + PANEL_WIDTH - barWidth * frames.size();
+    for (const auto& frame : frames) {
+        float height = 0.0f;
+        float tracked = 0.0f;
+        for (const auto& part : frame.parts) {
+            float partHeight = std::min(static_cast<float>(part.second) * scale, CHART_HEIGHT - height);
+            appendQuad(bars, left, bottom - height - partHeight, barWidth, partHeight, scopeColor(part.first));
+            height += partHeight;
+            tracked += static_cast<float>(part.second);
+        }
+
+        float untracked = std::max(0.0f, static_cast<float>(frame.milliseconds) - tracked);
+        float untrackedHeight = std::min(untracked * scale, CHART_HEIGHT - height);
+        appendQuad(bars, left, bottom - height - untrackedHeight, barWidth, untrackedHeight, UNTRACKED_COLOR);
+        left += barWidth;
+    }
+
+    // 60 fps budget
+    sf::Color lineColor(255, 255, 255, 140);
+    float budgetY = bottom - FRAME_BUDGET * scale;
+    budgetLine.append(sf::Vertex{sf::Vector2f(origin.x, budgetY), lineColor});
+    budgetLine.append(sf::Vertex{sf::Vector2f(origin.x + PANEL_WIDTH, budgetY), lineColor});
+}
+
+void ProfilerOverlay::buildText(const sf::Vector2f& origin, const DrawStats& draws) {
+    text.clear();
+    const bool allocations = AllocationTracker::isEnabled();
+    appendFormat(text, "%-16s%8s%8s%8s", "scope", "last", "p50", "p99");
+    if (allocations) {
+        appendFormat(text, "%8s%8s", "allocs", "KB");
+    }
+    text += "  ms\n";
+    profiler.getScopeStats(scopeStats);
+    for (const auto& scope : scopeStats) {
+        if (scope.samples == 0) continue;
+        appendFormat(text, "%-16s%8.2f%8.2f%8.2f", scope.name.c_str(),
+                     scope.lastMilliseconds, scope.p50Milliseconds, scope.p99Milliseconds);
+        if (allocations) {
+            appendFormat(text, "%8.1f%8.1f", scope.averageAllocations, scope.averageBytes / 1024.0);
+            if (scope.hasBudget && scope.overBudget > 0) {
+                appendFormat(text, "  over budget %zu", scope.overBudget);
+            }
+        }
+        text += '\n';
+    }
+
+    // Draw submissions of the last complete frame
+    appendFormat(text, "%-16s%8s%8s%8s%8s\n", "draws", "calls", "verts", "binds", "texts");
+    for (std::size_t i = 0; i < draws.categories.size(); ++i) {
+        const DrawTally& tally = draws.categories[i];
+        appendFormat(text, "%-16s%8zu%8zu%8zu%8zu\n", DrawStats::getCategoryName(static_cast<DrawCategory>(i)),
+                     tally.drawCalls, tally.vertices, tally.textureBinds, tally.texts);
+    }
+
+    if (AllocationTracker::getViolationCount() > 0) {
+        appendFormat(text, "no-alloc violations %llu\n", static_cast<unsigned long long>(AllocationTracker::getViolationCount()));
+    }
+    if (profiler.getDroppedSamples() > 0) {
+        appendFormat(text, "dropped samples %zu\n", profiler.getDroppedSamples());
+    }
+    if (profiler.isCapturing()) {
+        appendFormat(text, "capturing (F4 to save) %zu samples\n", profiler.getCapturedCount());
+    }
+
+    // Widened a character at a time: converting the whole std::string
+    // would build a temporary sf::String every frame
+    tableString.clear();
+    for (char c : text) {
+        tableString += sf::String(static_cast<char32_t>(static_cast<unsigned char>(c)));
+    }
+    table.setString(tableString);
+    table.setPosition(sf::Vector2f(origin.x, origin.y + CHART_HEIGHT + 20.0f));
+    legend.setPosition(sf::Vector2f(origin.x, origin.y + CHART_HEIGHT + 4.0f));
+}
+
+void ProfilerOverlay::draw(DrawTarget& target) {
+    if (!visible) return;
+
+    const sf::View& view = target.getView();
+    sf::Vector2f topLeft = view.getCenter() - view.getSize() / 2.0f;
+    sf::Vector2f origin = topLeft + sf::Vector2f(MARGIN * 2, MARGIN * 2);
+
+    buildBars(origin);
+    buildText(origin, target.getLastFrameStats());
+
+    float height = CHART_HEIGHT + 28.0f + table.getLocalBounds().size.y;
+    background.setSize(sf::Vector2f(PANEL_WIDTH + MARGIN * 2, height + MARGIN * 2));
+    background.setPosition(origin - sf::Vector2f(MARGIN, MARGIN));
+
+    target.draw(background);
+    target.draw(bars);
+    target.draw(budgetLine);
+    target.draw(legend);
+    target.draw(table);
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "DrawTarget.hpp"
+#include "Profiler.hpp"
+#include <SFML/Graphics.hpp>
+#include <string>
+#include <vector>
+
+// On-screen view of the frame profiler, toggled in game.
+// A rolling chart of the recent frames of one track, each bar split by the
+// scopes directly inside the frame, above last/p50/p99 (and, when tracked,
+// average allocations) for every scope and the previous frame's draw calls
+// per category.
+class ProfilerOverlay {
+private:
+    const Profiler& profiler;
+    const Profiler::Track* track;
+    bool visible;
+
+    sf::RectangleShape background;
+    sf::VertexArray bars;
+    sf::VertexArray budgetLine;
+    sf::Text legend;
+    sf::Text table;
+
+    // Scratch kept between frames, so drawing inside the frame scope
+    // does not allocate once these have grown
+    std::vector<Profiler::FrameRecord> frames;
+    std::vector<Profiler::ScopeStats> scopeStats;
+    std::string text;
+    sf::String tableString;
+
+    void buildBars(const sf::Vector2f& origin);
+    void buildText(const sf::Vector2f& origin, const DrawStats& draws);
+
+public:
+    ProfilerOverlay(const Profiler& profiler, const Profiler::Track* track, const sf::Font& font);
+
+    void toggle() { visible = !visible; }
+    bool isVisible() const { return visible; }
+
+    // Draw in the current view's coordinates, anchored at its top left
+    void draw(DrawTarget& target);
+};
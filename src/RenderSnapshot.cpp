@@ -0,0 +1,41 @@
+#include "RenderSnapshot.hpp"
+#include <algorithm>
+#include <utility>
+
+void RenderSnapshot::clear() {
+    tick = 0;
+    units.clear();
+    hero.exists = false;
+    hero.selected = false;
+    hero.armyOffsets.clear();
+    merchants.clear();
+    cities.clear();
+    ui = UiSnapshot();
+}
+
+float RenderSnapshot::interpolationAlpha(std::chrono::steady_clock::time_point now) const {
+    float elapsed = std::chrono::duration<float>(now - tickTime).count();
+    return std::clamp(elapsed / tickDuration, 0.0f, 1.0f);
+}
+
+SnapshotBuffer::SnapshotBuffer() : front(0), fresh(false) {
+}
+
+void SnapshotBuffer::publish() {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    front = 1 - front;
+    fresh = true;
+}
+
+bool SnapshotBuffer::acquire(RenderSnapshot& out) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!fresh) {
+        return false;
+    }
+
+    // Swap rather than copy; the writer clears whatever it gets back
+    std::swap(out, buffers[front]);
+    fresh = false;
+    return true;
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "GameEntities.hpp"
+#include "Territory.hpp"
+#include "TileBitset.hpp"
+#include <SFML/System/Vector2.hpp>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Plain-data copy of everything the renderer needs from one simulation tick.
+// The simulation thread fills it, the render thread only ever reads it.
+
+struct UnitSnapshot {
+    sf::Vector2f position;
+    sf::Vector2f previousPosition;  // Position one tick earlier
+    UnitType type = UnitType::Settler;
+    bool selected = false;
+    std::vector<sf::Vector2f> remainingPath;  // Only filled for the selected unit
+};
+
+struct HeroSnapshot {
+    bool exists = false;
+    sf::Vector2f position;
+    sf::Vector2f previousPosition;
+    bool selected = false;
+    std::vector<sf::Vector2f> armyOffsets;  // Formation slots relative to the hero
+};
+
+struct MerchantSnapshot {
+    sf::Vector2f position;
+    std::string name;
+};
+
+struct CitySnapshot {
+    sf::Vector2f position;
+    std::string name;
+    int population = 0;
+    bool playerNear = false;
+};
+
+struct UiSnapshot {
+    int turn = 1;
+    float turnTimeRemaining = 0.0f;
+    int heroGold = 0;
+    int heroLevel = 0;
+    std::string nearbyCityName;  // Empty when the hero is not near a city
+};
+
+struct RenderSnapshot {
+    std::uint64_t tick = 0;
+
+    // When the last tick finished and how long a tick lasts; the renderer
+    // uses these to interpolate between previous and current positions
+    std::chrono::steady_clock::time_point tickTime;
+    float tickDuration = 1.0f / 60.0f;
+
+    std::vector<UnitSnapshot> units;
+    HeroSnapshot hero;
+    std::vector<MerchantSnapshot> merchants;
+    std::vector<CitySnapshot> cities;
+    std::shared_ptr<const BorderMesh> borders;  // Territory borders; null before the first build
+    TileBitset visibleTiles;   // Empty before the first build: draw everything
+    TileBitset revealedTiles;
+    UiSnapshot ui;
+
+    // Reset contents but keep allocated capacity
+    void clear();
+
+    // Interpolation factor between previous and current positions at 'now'
+    float interpolationAlpha(std::chrono::steady_clock::time_point now) const;
+};
+
+// Double buffer between the simulation (writer) and render (reader) threads.
+// The writer fills back() and publishes it; the reader swaps the newest
+// published snapshot into its own copy, so neither side ever waits on the
+// other for longer than a pointer swap.
+class SnapshotBuffer {
+private:
+    RenderSnapshot buffers[2];
+    int front;
+    bool fresh;
+    std::mutex mutex;
+
+public:
+    SnapshotBuffer();
+
+    // Simulation thread: the buffer to fill for the next publish
+    RenderSnapshot& back() { return buffers[1 - front]; }
+
+    // Simulation thread: make back() the latest snapshot
+    void publish();
+
+    // Render thread: swap the latest snapshot into 'out'.
+    // Returns false if nothing new was published since the last call.
+    bool acquire(RenderSnapshot& out);
+};
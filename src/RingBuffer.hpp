@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+// FIFO queue over a circular array. push_back and pop_front are O(1) and
+// never shift the other elements; the storage doubles when full and is
+// kept when the queue drains, so a steady queue stops allocating.
+template <typename T>
+class RingBuffer {
+private:
+    std::vector<T> slots;   // Capacity is always zero or a power of two
+    std::size_t head = 0;   // Slot of the front element
+    std::size_t count = 0;
+
+    std::size_t slotOf(std::size_t i) const { return (head + i) & (slots.size() - 1); }
+
+    void grow() {
+        std::vector<T> larger(slots.empty() ? 4 : slots.size() * 2);
+        for (std::size_t i = 0; i < count; ++i) {
+            larger[i] = std::move(slots[slotOf(i)]);
+        }
+        slots.swap(larger);
+        head = 0;
+    }
+
+public:
+    void push_back(const T& value) {
+        if (count == slots.size()) grow();
+        slots[slotOf(count)] = value;
+        ++count;
+    }
+
+    // Call only when not empty
+    T& front() { return slots[head]; }
+    const T& front() const { return slots[head]; }
+
+    void pop_front() {
+        head = slotOf(1);
+        --count;
+    }
+
+    // i counts from the front
+    T& operator[](std::size_t i) { return slots[slotOf(i)]; }
+    const T& operator[](std::size_t i) const { return slots[slotOf(i)]; }
+
+    void clear() {
+        head = 0;
+        count = 0;
+    }
+
+    std::size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    std::size_t capacity() const { return slots.size(); }
+};
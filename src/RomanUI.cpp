@@ -1,5 +1,35 @@
 #include "RomanUI.hpp"
+#include "Definitions.hpp"
+#include "FrameArena.hpp"
 #include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+
+namespace {
+    // Fixed entries of the placeholder panels
+    struct LabeledValue {
+        const char* name;
+        int value;
+    };
+
+    // "name<separator>value<suffix>" built in frame scratch
+    FrameString formatLabel(DrawTarget& window, const char* name, const char* separator, int value, const char* suffix) {
+        FrameString label(window.getScratch());
+        char number[16];
+        std::snprintf(number, sizeof(number), "%d", value);
+        label.reserve(std::strlen(name) + std::strlen(separator) + std::strlen(number) + std::strlen(suffix));
+        label += name;
+        label += separator;
+        label += number;
+        label += suffix;
+        return label;
+    }
+
+    sf::Color toColor(Definitions::Rgba color) {
+        return sf::Color(color.r, color.g, color.b, color.a);
+    }
+}
 
 namespace RomanUI {
     
@@ -13,9 +43,9 @@ namespace RomanUI {
         return button;
     }
     
-    sf::Text createRomanText(const std::string& text, const sf::Font& font, unsigned int size) {
+    sf::Text createRomanText(std::string_view text, const sf::Font& font, unsigned int size) {
         sf::Text romanText(font);
-        romanText.setString(text);
+        romanText.setString(sf::String::fromUtf8(text.begin(), text.end()));
         romanText.setCharacterSize(size);
         romanText.setFillColor(Colors::TEXT_PRIMARY);
         romanText.setOutlineThickness(1.0f);
@@ -43,7 +73,7 @@ namespace RomanUI {
         return modal;
     }
     
-    void drawRomanBorder(sf::RenderWindow& window, float x, float y, float width, float height) {
+    void drawRomanBorder(DrawTarget& window, float x, float y, float width, float height) {
         // Outer border - Roman red
         sf::RectangleShape outerBorder(sf::Vector2f(width, height));
         outerBorder.setPosition(sf::Vector2f(x, y));
@@ -68,7 +98,7 @@ namespace RomanUI {
         }
     }
     
-    void drawRomanColumn(sf::RenderWindow& window, float x, float y, float height) {
+    void drawRomanColumn(DrawTarget& window, float x, float y, float height) {
         // Column base
         sf::RectangleShape base(sf::Vector2f(20, 8));
         base.setPosition(sf::Vector2f(x - 2, y + height - 8));
@@ -90,7 +120,7 @@ namespace RomanUI {
         window.draw(capital);
     }
     
-    void drawEagleEmblem(sf::RenderWindow& window, float x, float y, float size) {
+    void drawEagleEmblem(DrawTarget& window, float x, float y, float size) {
         // Eagle body (simplified)
         sf::CircleShape body(size * 0.4f);
         body.setPosition(sf::Vector2f(x, y));
@@ -117,7 +147,7 @@ namespace RomanUI {
         window.draw(rightWing);
     }
     
-    void drawRomanHexagon(sf::RenderWindow& window, const game::Tile& tile, float hexSize) {
+    void drawRomanHexagon(DrawTarget& window, const game::Tile& tile, float hexSize) {
         const sf::Vector2f& center = tile.center;
         
         // Create hexagon with 6 points
@@ -132,27 +162,7 @@ namespace RomanUI {
         }
         
         // Set Roman-themed colors based on terrain
-        sf::Color tileColor;
-        switch (tile.type) {
-            case game::TileType::Plains:
-                tileColor = Colors::ROMAN_FIELDS;
-                break;
-            case game::TileType::Hills:
-                tileColor = Colors::ROMAN_HILLS;
-                break;
-            case game::TileType::Mountain:
-                tileColor = sf::Color(105, 105, 105);
-                break;
-            case game::TileType::Forest:
-                tileColor = sf::Color(85, 107, 47);
-                break;
-            case game::TileType::Water:
-                tileColor = Colors::MEDITERRANEAN_BLUE;
-                break;
-            default:
-                tileColor = Colors::ROMAN_FIELDS;
-                break;
-        }
+        sf::Color tileColor = toColor(Definitions::getTerrain(tile.type).color);
         
         hexagon.setFillColor(tileColor);
         hexagon.setOutlineThickness(1.5f);
@@ -187,7 +197,7 @@ namespace RomanUI {
         }
     }
     
-    void drawRomanCity(sf::RenderWindow& window, const sf::Vector2f& position, 
+    void drawRomanCity(DrawTarget& window, const sf::Vector2f& position, 
                        const std::string& name, const sf::Font& font, bool isPlayerNear) {
         // City walls (Roman architecture)
         sf::RectangleShape cityWalls(sf::Vector2f(50, 50));
@@ -229,7 +239,7 @@ namespace RomanUI {
         window.draw(cityName);
     }
     
-    void drawSidebar(sf::RenderWindow& window, float windowWidth, float windowHeight, 
+    void drawSidebar(DrawTarget& window, float windowWidth, float windowHeight, 
                      const sf::Font& font, const sf::Vector2f& playerPos) {
         float sidebarX = windowWidth - Layout::SIDEBAR_WIDTH;
         
@@ -316,7 +326,7 @@ namespace RomanUI {
         window.draw(foodText);
     }
     
-    void drawMinimap(sf::RenderWindow& window, float x, float y, float size, 
+    void drawMinimap(DrawTarget& window, float x, float y, float size, 
                      const sf::Vector2f& playerPosition, const sf::Vector2f& mapSize) {
         // Minimap background
         sf::RectangleShape minimapBg(sf::Vector2f(size, size));
@@ -354,7 +364,7 @@ namespace RomanUI {
         drawEagleEmblem(window, playerX, playerY, 8);
     }
     
-    void drawCharacterModal(sf::RenderWindow& window, const sf::Font& font) {
+    void drawCharacterModal(DrawTarget& window, const sf::Font& font) {
         float modalX = (window.getSize().x - Layout::MODAL_WIDTH) / 2;
         float modalY = (window.getSize().y - Layout::MODAL_HEIGHT) / 2;
         
@@ -421,7 +431,7 @@ namespace RomanUI {
         window.draw(closeText);
     }
     
-    void drawArmyModal(sf::RenderWindow& window, const sf::Font& font) {
+    void drawArmyModal(DrawTarget& window, const sf::Font& font) {
         float modalX = (window.getSize().x - Layout::MODAL_WIDTH) / 2;
         float modalY = (window.getSize().y - Layout::MODAL_HEIGHT) / 2;
         
@@ -441,13 +451,13 @@ namespace RomanUI {
         float currentY = modalY + 70;
         
         // Army units display
-        std::vector<std::string> units = {"Legionnaire x15", "Archer x8", "Cavalry x5", "Siege Engine x2"};
+        const LabeledValue units[] = {{"Legionnaire", 15}, {"Archer", 8}, {"Cavalry", 5}, {"Siege Engine", 2}};
         
-        for (size_t i = 0; i < units.size(); ++i) {
+        for (size_t i = 0; i < std::size(units); ++i) {
             sf::RectangleShape unitSlot = createRomanPanel(modalX + 30, currentY, 200, 30);
             window.draw(unitSlot);
             
-            sf::Text unitText = createRomanText(units[i], font, 12);
+            sf::Text unitText = createRomanText(formatLabel(window, units[i].name, " x", units[i].value, ""), font, 12);
             unitText.setPosition(sf::Vector2f(modalX + 40, currentY + 8));
             window.draw(unitText);
             
@@ -476,7 +486,7 @@ namespace RomanUI {
         window.draw(closeText);
     }
     
-    void drawCityModal(sf::RenderWindow& window, const sf::Font& font) {
+    void drawCityModal(DrawTarget& window, const sf::Font& font) {
         float modalX = (window.getSize().x - Layout::MODAL_WIDTH) / 2;
         float modalY = (window.getSize().y - Layout::MODAL_HEIGHT) / 2;
         
@@ -512,11 +522,11 @@ namespace RomanUI {
         window.draw(buildingTitle);
         currentY += 30;
         
-        std::vector<std::string> buildings = {"Forum", "Barracks", "Market", "Temple", "Aqueduct"};
+        const char* const buildings[] = {"Forum", "Barracks", "Market", "Temple", "Aqueduct"};
         
         int col = 0;
         float startY = currentY;
-        for (size_t i = 0; i < buildings.size(); ++i) {
+        for (size_t i = 0; i < std::size(buildings); ++i) {
             float btnX = modalX + 30 + (col * 120);
             float btnY = startY + ((i / 4) * 50);
             
@@ -538,7 +548,7 @@ namespace RomanUI {
         window.draw(closeText);
     }
     
-    void drawSkillsModal(sf::RenderWindow& window, const sf::Font& font) {
+    void drawSkillsModal(DrawTarget& window, const sf::Font& font) {
         float modalX = (window.getSize().x - Layout::MODAL_WIDTH) / 2;
         float modalY = (window.getSize().y - Layout::MODAL_HEIGHT) / 2;
         
@@ -564,12 +574,12 @@ namespace RomanUI {
         currentY += 40;
         
         // Skills list
-        std::vector<std::pair<std::string, int>> skills = {
+        const LabeledValue skills[] = {
             {"Leadership", 3}, {"Tactics", 2}, {"Archery", 1}, {"Engineering", 2}, {"Diplomacy", 1}
         };
         
-        for (size_t i = 0; i < skills.size(); ++i) {
-            sf::Text skillText = createRomanText(skills[i].first + ": Level " + std::to_string(skills[i].second), font, 12);
+        for (size_t i = 0; i < std::size(skills); ++i) {
+            sf::Text skillText = createRomanText(formatLabel(window, skills[i].name, ": Level ", skills[i].value, ""), font, 12);
             skillText.setPosition(sf::Vector2f(modalX + 30, currentY));
             window.draw(skillText);
             
@@ -592,7 +602,7 @@ namespace RomanUI {
         window.draw(closeText);
     }
     
-    void drawBuildingModal(sf::RenderWindow& window, const sf::Font& font, const std::string& buildingType) {
+    void drawBuildingModal(DrawTarget& window, const sf::Font& font, const std::string& buildingType) {
         float modalX = (window.getSize().x - Layout::MODAL_WIDTH) / 2;
         float modalY = (window.getSize().y - Layout::MODAL_HEIGHT) / 2;
         
@@ -604,7 +614,9 @@ namespace RomanUI {
         drawRomanBorder(window, modalX + 10, modalY + 10, Layout::MODAL_WIDTH - 20, Layout::MODAL_HEIGHT - 20);
         
         // Title
-        sf::Text title = createRomanText(buildingType + " OF ROME", font, 20);
+        FrameString titleText(buildingType.begin(), buildingType.end(), window.getScratch());
+        titleText += " OF ROME";
+        sf::Text title = createRomanText(titleText, font, 20);
         title.setPosition(sf::Vector2f(modalX + 30, modalY + 30));
         title.setFillColor(Colors::ROMAN_GOLD);
         window.draw(title);
@@ -618,12 +630,12 @@ namespace RomanUI {
             window.draw(recruitTitle);
             currentY += 30;
             
-            std::vector<std::pair<std::string, int>> units = {
+            const LabeledValue units[] = {
                 {"Legionnaire", 50}, {"Archer", 75}, {"Cavalry", 150}, {"Siege Engine", 300}
             };
             
-            for (size_t i = 0; i < units.size(); ++i) {
-                sf::Text unitText = createRomanText(units[i].first + " - " + std::to_string(units[i].second) + " Gold", font, 12);
+            for (size_t i = 0; i < std::size(units); ++i) {
+                sf::Text unitText = createRomanText(formatLabel(window, units[i].name, " - ", units[i].value, " Gold"), font, 12);
                 unitText.setPosition(sf::Vector2f(modalX + 30, currentY));
                 window.draw(unitText);
                 
@@ -642,12 +654,12 @@ namespace RomanUI {
             window.draw(tradeTitle);
             currentY += 30;
             
-            std::vector<std::pair<std::string, int>> items = {
+            const LabeledValue items[] = {
                 {"Iron Sword", 100}, {"Shield", 50}, {"Healing Potion", 25}, {"Map Scroll", 75}
             };
             
-            for (size_t i = 0; i < items.size(); ++i) {
-                sf::Text itemText = createRomanText(items[i].first + " - " + std::to_string(items[i].second) + " Gold", font, 12);
+            for (size_t i = 0; i < std::size(items); ++i) {
+                sf::Text itemText = createRomanText(formatLabel(window, items[i].name, " - ", items[i].value, " Gold"), font, 12);
                 itemText.setPosition(sf::Vector2f(modalX + 30, currentY));
                 window.draw(itemText);
                 
@@ -671,7 +683,7 @@ namespace RomanUI {
     }
     
     // 2.5D Enhanced rendering functions
-    void drawRomanHexagon2D5(sf::RenderWindow& window, const game::Tile& tile, float hexSize) {
+    void drawRomanHexagon2D5(DrawTarget& window, const game::Tile& tile, float hexSize) {
         const sf::Vector2f& center = tile.center;
         
         // Create main hexagon with 6 points
@@ -693,33 +705,9 @@ namespace RomanUI {
         }
         
         // Set Roman-themed colors based on terrain with enhanced shading
-        sf::Color tileColor, shadowColor;
-        switch (tile.type) {
-            case game::TileType::Plains:
-                tileColor = Colors::ROMAN_FIELDS;
-                shadowColor = sf::Color(Colors::ROMAN_FIELDS.r * 0.6f, Colors::ROMAN_FIELDS.g * 0.6f, Colors::ROMAN_FIELDS.b * 0.6f, 120);
-                break;
-            case game::TileType::Hills:
-                tileColor = Colors::ROMAN_HILLS;
-                shadowColor = sf::Color(Colors::ROMAN_HILLS.r * 0.6f, Colors::ROMAN_HILLS.g * 0.6f, Colors::ROMAN_HILLS.b * 0.6f, 120);
-                break;
-            case game::TileType::Mountain:
-                tileColor = sf::Color(105, 105, 105);
-                shadowColor = sf::Color(60, 60, 60, 120);
-                break;
-            case game::TileType::Forest:
-                tileColor = sf::Color(85, 107, 47);
-                shadowColor = sf::Color(50, 64, 28, 120);
-                break;
-            case game::TileType::Water:
-                tileColor = Colors::MEDITERRANEAN_BLUE;
-                shadowColor = sf::Color(Colors::MEDITERRANEAN_BLUE.r * 0.5f, Colors::MEDITERRANEAN_BLUE.g * 0.5f, Colors::MEDITERRANEAN_BLUE.b * 0.5f, 120);
-                break;
-            default:
-                tileColor = Colors::ROMAN_FIELDS;
-                shadowColor = sf::Color(Colors::ROMAN_FIELDS.r * 0.6f, Colors::ROMAN_FIELDS.g * 0.6f, Colors::ROMAN_FIELDS.b * 0.6f, 120);
-                break;
-        }
+        const Definitions::TerrainDefinition& terrain = Definitions::getTerrain(tile.type);
+        sf::Color tileColor = toColor(terrain.color);
+        sf::Color shadowColor = toColor(terrain.shadowColor);
         
         // Draw shadow first
         shadowHex.setFillColor(shadowColor);
@@ -761,7 +749,7 @@ namespace RomanUI {
         }
     }
     
-    void drawRomanCity2D5(sf::RenderWindow& window, const sf::Vector2f& position, 
+    void drawRomanCity2D5(DrawTarget& window, const sf::Vector2f& position, 
                           const std::string& name, const sf::Font& font, bool isPlayerNear) {
         // City shadow for depth
         sf::RectangleShape cityShadow(sf::Vector2f(50, 50));
@@ -841,7 +829,7 @@ namespace RomanUI {
         window.draw(cityName);
     }
     
-    void drawSpriteCharacter(sf::RenderWindow& window, const sf::Vector2f& position, 
+    void drawSpriteCharacter(DrawTarget& window, const sf::Vector2f& position, 
                             const sf::Texture& spriteTexture, bool isSelected) {
         // Character shadow for depth
         sf::CircleShape shadow(16.0f);
@@ -877,7 +865,7 @@ namespace RomanUI {
         }
     }
     
-    void drawShadow(sf::RenderWindow& window, const sf::Vector2f& position, float size) {
+    void drawShadow(DrawTarget& window, const sf::Vector2f& position, float size) {
         sf::CircleShape shadow(size);
         shadow.setPosition(sf::Vector2f(position.x - size + Layout::SHADOW_OFFSET, 
                                        position.y - size + Layout::SHADOW_OFFSET));
@@ -885,7 +873,7 @@ namespace RomanUI {
         window.draw(shadow);
     }
     
-    void drawGlow(sf::RenderWindow& window, const sf::Vector2f& position, float radius, const sf::Color& color) {
+    void drawGlow(DrawTarget& window, const sf::Vector2f& position, float radius, const sf::Color& color) {
         sf::CircleShape glow(radius);
         glow.setPosition(sf::Vector2f(position.x - radius, position.y - radius));
         sf::Color glowColor = color;
@@ -3,6 +3,8 @@
 
 #include <SFML/Graphics.hpp>
 #include "GameEntities.hpp"
+#include "DrawTarget.hpp"
+#include <string_view>
 
 namespace RomanUI {
     // Roman Empire inspired color palette
@@ -64,43 +66,43 @@ namespace RomanUI {
     
     // Button creation functions
     sf::RectangleShape createRomanButton(float x, float y, float width, float height);
-    sf::Text createRomanText(const std::string& text, const sf::Font& font, unsigned int size = 14);
+    sf::Text createRomanText(std::string_view text, const sf::Font& font, unsigned int size = 14);
     sf::RectangleShape createRomanPanel(float x, float y, float width, float height);
     sf::RectangleShape createModal(float x, float y, float width, float height);
     
     // Decorative elements
-    void drawRomanBorder(sf::RenderWindow& window, float x, float y, float width, float height);
-    void drawRomanColumn(sf::RenderWindow& window, float x, float y, float height);
-    void drawEagleEmblem(sf::RenderWindow& window, float x, float y, float size);
+    void drawRomanBorder(DrawTarget& window, float x, float y, float width, float height);
+    void drawRomanColumn(DrawTarget& window, float x, float y, float height);
+    void drawEagleEmblem(DrawTarget& window, float x, float y, float size);
     
     // Enhanced terrain for Roman theme
-    void drawRomanHexagon(sf::RenderWindow& window, const game::Tile& tile, float hexSize);
-    void drawRomanCity(sf::RenderWindow& window, const sf::Vector2f& position, 
+    void drawRomanHexagon(DrawTarget& window, const game::Tile& tile, float hexSize);
+    void drawRomanCity(DrawTarget& window, const sf::Vector2f& position, 
                        const std::string& name, const sf::Font& font, bool isPlayerNear = false);
     
     // 2.5D Enhanced rendering functions
-    void drawRomanHexagon2D5(sf::RenderWindow& window, const game::Tile& tile, float hexSize);
-    void drawRomanCity2D5(sf::RenderWindow& window, const sf::Vector2f& position, 
+    void drawRomanHexagon2D5(DrawTarget& window, const game::Tile& tile, float hexSize);
+    void drawRomanCity2D5(DrawTarget& window, const sf::Vector2f& position, 
                           const std::string& name, const sf::Font& font, bool isPlayerNear = false);
-    void drawSpriteCharacter(sf::RenderWindow& window, const sf::Vector2f& position, 
+    void drawSpriteCharacter(DrawTarget& window, const sf::Vector2f& position, 
                             const sf::Texture& spriteTexture, bool isSelected = false);
     
     // Enhanced visual effects
-    void drawShadow(sf::RenderWindow& window, const sf::Vector2f& position, float size);
-    void drawGlow(sf::RenderWindow& window, const sf::Vector2f& position, float radius, const sf::Color& color);
+    void drawShadow(DrawTarget& window, const sf::Vector2f& position, float size);
+    void drawGlow(DrawTarget& window, const sf::Vector2f& position, float radius, const sf::Color& color);
     
     // UI Components
-    void drawSidebar(sf::RenderWindow& window, float windowWidth, float windowHeight, 
+    void drawSidebar(DrawTarget& window, float windowWidth, float windowHeight, 
                      const sf::Font& font, const sf::Vector2f& playerPos);
-    void drawMinimap(sf::RenderWindow& window, float x, float y, float size, 
+    void drawMinimap(DrawTarget& window, float x, float y, float size, 
                      const sf::Vector2f& playerPosition, const sf::Vector2f& mapSize);
     
     // Modal rendering
-    void drawCharacterModal(sf::RenderWindow& window, const sf::Font& font);
-    void drawArmyModal(sf::RenderWindow& window, const sf::Font& font);
-    void drawCityModal(sf::RenderWindow& window, const sf::Font& font);
-    void drawSkillsModal(sf::RenderWindow& window, const sf::Font& font);
-    void drawBuildingModal(sf::RenderWindow& window, const sf::Font& font, const std::string& buildingType);
+    void drawCharacterModal(DrawTarget& window, const sf::Font& font);
+    void drawArmyModal(DrawTarget& window, const sf::Font& font);
+    void drawCityModal(DrawTarget& window, const sf::Font& font);
+    void drawSkillsModal(DrawTarget& window, const sf::Font& font);
+    void drawBuildingModal(DrawTarget& window, const sf::Font& font, const std::string& buildingType);
 }
 
 #endif // ROMAN_UI_HPP
@@ -0,0 +1,351 @@
+#include "Simulation.hpp"
+#include "Definitions.hpp"
+#include "Systems.hpp"
+#include "HexGrid.hpp"
+#include "Log.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+Simulation::Simulation(int width, int height, float size, float tickRate)
+    : mapWidth(width),
+      mapHeight(height),
+      hexSize(size),
+      tileMap(width, std::vector<game::Tile>(height)),
+      territory(tileMap, size),
+      tileYields(tileMap, territory, size),
+      visibility(tileMap, size),
+      unitManager(world),
+      cityManager(world),
+      gameManager(world),
+      turnLength(10.0f),   // 10 seconds per turn
+      turnTimer(10.0f),
+      turnNumber(1),
+      tickCount(0),
+      rng(std::random_device{}()),
+      workerPool(std::make_unique<ThreadPool>()),
+      profileTrack(nullptr),
+      running(false),
+      worldActive(false),
+      turnClockActive(false),
+      timestep(tickRate)
+{
+    buildTurnPipeline();
+}
+
+Simulation::~Simulation() {
+    stop();
+}
+
+void Simulation::setSeed(unsigned int seed) {
+    rng.seed(seed);
+    cityManager.setSeed(seed);
+}
+
+void Simulation::setProfiler(Profiler& profiler) {
+    profileTrack = profiler.addTrack("simulation");
+    profileScopes.tick = profiler.addScope("tick");
+    profileScopes.territory = profiler.addScope("territory");
+    profileScopes.turn = profiler.addScope("turn");
+    profileScopes.gameManager = profiler.addScope("game manager");
+    profileScopes.movement = profiler.addScope("movement");
+    profileScopes.visibility = profiler.addScope("visibility");
+}
+
+void Simulation::buildTurnPipeline() {
+    // Cities collect their tile yields, build and grow, finished items are
+    // placed, then new cities may be founded
+    turnPipeline.addStage("yields", [this](TurnContext& context) {
+        tileYields.sync(world);
+        cityManager.applyWorkedYields(tileYields, context.pool);
+    });
+    turnPipeline.addStage("production", [this](TurnContext& context) {
+        cityManager.processProduction(context.pool, context.events);
+    });
+    turnPipeline.addStage("growth", [this](TurnContext& context) {
+        cityManager.processGrowth(context.pool);
+    });
+    turnPipeline.addStage("completion", [this](TurnContext& context) {
+        unitManager.spawnUnits(context.events.unitsSpawned);
+        cityManager.addBuildings(context.events.buildingsAdded);
+    });
+    turnPipeline.addStage("expansion", [this](TurnContext& context) {
+        cityManager.updateSpawning(context.deltaTime);
+    });
+}
+
+void Simulation::setWorkerThreads(unsigned int count) {
+    workerPool = std::make_unique<ThreadPool>(count);
+}
+
+void Simulation::generateMap() {
+    // Terrain is drawn by weight, walking the types in this fixed order
+    const TileType generationOrder[] = {
+        TileType::Plains, TileType::Forest, TileType::Hills, TileType::Water, TileType::Mountain
+    };
+    int totalWeight = 0;
+    for (TileType type : generationOrder) {
+        totalWeight += Definitions::getTerrain(type).mapWeight;
+    }
+    std::uniform_int_distribution<int> roll(0, std::max(totalWeight, 1) - 1);
+
+    // Set up each tile's center and randomly assign a tile type.
+    // Using an odd-r layout for zig-zag tiling:
+    for (int r = 0; r < mapHeight; ++r) {
+        for (int q = 0; q < mapWidth; ++q) {
+            // Compute pixel positions
+            float xPos = hexSize * std::sqrt(3.f) * (q + 0.5f * (r % 2));
+            float yPos = hexSize * 1.5f * r;
+            tileMap[q][r].center = sf::Vector2f(xPos, yPos);
+
+            // Assign tile type randomly by terrain weight
+            int tileRand = roll(rng);
+            TileType type = TileType::Plains;
+            for (TileType candidate : generationOrder) {
+                type = candidate;
+                tileRand -= Definitions::getTerrain(candidate).mapWeight;
+                if (tileRand < 0) break;
+            }
+            tileMap[q][r].type = type;
+            tileMap[q][r].stats = Definitions::getTerrain(type).stats;
+        }
+    }
+}
+
+void Simulation::initialize() {
+    generateMap();
+    territory.reset();
+    tileYields.reset();
+    visibility.reset();
+
+    // Initialize the game manager and hero at the starting position
+    gameManager.initialize(tileMap[5][5].center);
+    placeStartingEntities();
+}
+
+void Simulation::placeStartingEntities() {
+    // Place basic units with the UnitManager
+    unitManager.addUnit(tileMap[5][5].center, UnitType::Settler);
+    unitManager.addUnit(tileMap[7][5].center, UnitType::Warrior);
+
+    // Add pre-generated cities at strategic locations using the same coordinate system
+    cityManager.addCity(tileMap[10][10].center);
+    cityManager.addCity(tileMap[15][8].center);
+    cityManager.addCity(tileMap[20][15].center);
+    cityManager.addCity(tileMap[12][20].center);
+
+    LOG_INFO("sim", "Total cities: {}", cityManager.getCityCount());
+    territory.sync(world);
+    visibility.update(world);
+}
+
+void Simulation::start() {
+    if (running) return;
+
+    running = true;
+    thread = std::thread(&Simulation::run, this);
+}
+
+void Simulation::stop() {
+    running = false;
+    if (thread.joinable()) {
+        thread.join();
+    }
+}
+
+void Simulation::setActivity(bool worldIsActive, bool turnClockIsActive) {
+    worldActive = worldIsActive;
+    turnClockActive = turnClockIsActive;
+}
+
+void Simulation::run() {
+    using Clock = std::chrono::steady_clock;
+
+    timestep.reset();
+    auto previous = Clock::now();
+    while (running) {
+        auto now = Clock::now();
+        float elapsed = std::chrono::duration<float>(now - previous).count();
+        previous = now;
+
+        // Run however many whole ticks are due; a slow render or a heavy turn
+        // never changes the step size, only how many steps we catch up
+        int ticksDue = timestep.advance(elapsed);
+        if (ticksDue > 0) {
+            {
+                std::lock_guard<std::mutex> lock(worldMutex);
+                for (int i = 0; i < ticksDue; ++i) {
+                    tick();
+                }
+                lastTickTime = Clock::now();
+                buildSnapshot(snapshots.back());
+            }
+            snapshots.publish();
+        }
+
+        auto wait = std::chrono::duration<float>(timestep.getTimeUntilNextTick());
+        std::this_thread::sleep_until(now + std::chrono::duration_cast<Clock::duration>(wait));
+    }
+}
+
+void Simulation::tick() {
+    update(timestep.getTickDuration());
+}
+
+void Simulation::update(float deltaTime) {
+    ProfileScope tickTimer(profileTrack, profileScopes.tick);
+    ++tickCount;
+
+    Systems::storePreviousPositions(world);
+
+    // Borders follow founded and removed cities right away
+    {
+        ProfileScope timer(profileTrack, profileScopes.territory);
+        territory.sync(world);
+    }
+
+    // Turn timer only runs while actually playing
+    if (turnClockActive) {
+        turnTimer -= deltaTime;
+        if (turnTimer <= 0.0f) {
+            ProfileScope timer(profileTrack, profileScopes.turn);
+
+            // Resolve the turn stage by stage
+            turnEvents.clear();
+            TurnContext context{*workerPool, turnEvents, turnNumber, deltaTime};
+            turnPipeline.run(context);
+            ++turnNumber;
+
+            // Reset timer
+            turnTimer = turnLength;
+        }
+    }
+
+    // Update game manager
+    {
+        ProfileScope timer(profileTrack, profileScopes.gameManager);
+        gameManager.update(deltaTime);
+    }
+
+    // Units and the hero move along their paths
+    if (worldActive) {
+        ProfileScope timer(profileTrack, profileScopes.movement);
+        Systems::updateMovement(world, movementBatch, deltaTime);
+    }
+
+    // Only observers that changed tile look around again
+    ProfileScope visibilityTimer(profileTrack, profileScopes.visibility);
+    visibility.update(world);
+}
+
+sf::Vector2i Simulation::worldToTile(const sf::Vector2f& position) const {
+    return HexGrid::worldToTile(position, hexSize, mapWidth, mapHeight);
+}
+
+Entity Simulation::findCityNear(const sf::Vector2f& position, float radius) const {
+    return world.findNearest(world.cities, position, radius);
+}
+
+void Simulation::buildSnapshot(RenderSnapshot& snapshot) {
+    snapshot.clear();
+    snapshot.tick = tickCount;
+    snapshot.tickTime = lastTickTime;
+    snapshot.tickDuration = timestep.getTickDuration();
+
+    // Fog of war applies to entities too: other factions' units and the
+    // merchants are only sent while their tile is in sight, cities once
+    // their tile has been explored
+    const TileBitset& visible = visibility.getVisible(Faction::PLAYER);
+    const TileBitset& revealed = visibility.getRevealed(Faction::PLAYER);
+    auto isOnTile = [this](const TileBitset& tiles, const sf::Vector2f& position) {
+        if (tiles.empty()) return true;
+        sf::Vector2i tile = worldToTile(position);
+        return tiles.test(static_cast<std::size_t>(tile.x) * mapHeight + tile.y);
+    };
+
+    // Units
+    const auto& units = world.units.data();
+    for (size_t i = 0; i < units.size(); ++i) {
+        Entity entity = world.units.entityAt(i);
+        const Position* position = world.positions.get(entity);
+        if (world.getFaction(entity) != Faction::PLAYER && !isOnTile(visible, position->current)) continue;
+        const Selectable* selectable = world.selectables.get(entity);
+
+        UnitSnapshot unitSnapshot;
+        unitSnapshot.position = position->current;
+        unitSnapshot.previousPosition = position->previous;
+        unitSnapshot.type = units[i].type;
+        unitSnapshot.selected = selectable && selectable->selected;
+
+        // Only the selected unit shows its path
+        const MovementPath* path = world.paths.get(entity);
+        if (unitSnapshot.selected && path) {
+            world.pathPool.copyWaypoints(*path, path->next, unitSnapshot.remainingPath);
+        }
+        snapshot.units.push_back(std::move(unitSnapshot));
+    }
+
+    // Hero and army formation
+    Hero* hero = gameManager.getPlayerHero();
+    const Position* heroPosition = world.positions.get(gameManager.getPlayerHeroEntity());
+    if (hero && heroPosition) {
+        snapshot.hero.exists = true;
+        snapshot.hero.position = heroPosition->current;
+        snapshot.hero.previousPosition = heroPosition->previous;
+        snapshot.hero.selected = gameManager.isHeroSelected();
+
+        Army* army = gameManager.getPlayerArmy();
+        if (army) {
+            const auto& offsets = army->getFormationOffsets();
+            for (int i = 0; i < army->getSize() && i < static_cast<int>(offsets.size()); ++i) {
+                snapshot.hero.armyOffsets.push_back(offsets[i]);
+            }
+        }
+
+        snapshot.ui.heroGold = hero->getGold();
+        snapshot.ui.heroLevel = hero->getLevel();
+    }
+
+    // Merchants
+    const auto& merchants = world.merchants.data();
+    for (size_t i = 0; i < merchants.size(); ++i) {
+        const sf::Vector2f& position = *world.getPosition(world.merchants.entityAt(i));
+        if (!isOnTile(visible, position)) continue;
+        snapshot.merchants.push_back(MerchantSnapshot{position, merchants[i].getName()});
+    }
+
+    // Cities, with proximity to the hero from the spatial index
+    nearbyCities.clear();
+    if (snapshot.hero.exists) {
+        world.findNearest(world.cities, heroPosition->current, world.cities.size(), nearbyCities,
+                          getCityInteractionRadius());
+        if (!nearbyCities.empty()) {
+            snapshot.ui.nearbyCityName = world.cities.get(nearbyCities.front())->getName();
+        }
+    }
+
+    const auto& cities = world.cities.data();
+    for (size_t i = 0; i < cities.size(); ++i) {
+        Entity entity = world.cities.entityAt(i);
+        const game::GameCity& city = cities[i];
+        const sf::Vector2f& position = *world.getPosition(entity);
+        if (!isOnTile(revealed, position)) continue;
+
+        CitySnapshot citySnapshot;
+        citySnapshot.position = position;
+        citySnapshot.name = city.getName();
+        citySnapshot.population = city.getPopulation();
+        citySnapshot.playerNear = std::find(nearbyCities.begin(), nearbyCities.end(), entity) != nearbyCities.end();
+        snapshot.cities.push_back(std::move(citySnapshot));
+    }
+
+    // Borders are shared, not copied; the mesh only changes with ownership
+    snapshot.borders = territory.getBorderMesh();
+
+    // The player's fog of war; a few kilobytes even on large maps
+    snapshot.visibleTiles = visible;
+    snapshot.revealedTiles = revealed;
+
+    snapshot.ui.turn = turnNumber;
+    snapshot.ui.turnTimeRemaining = turnTimer;
+}
@@ -0,0 +1,181 @@
+#pragma once
+
+#include "GameEntities.hpp"
+#include "World.hpp"
+#include "MovementKernel.hpp"
+#include "CityManager.hpp"
+#include "UnitManager.hpp"
+#include "GameManager.hpp"
+#include "RenderSnapshot.hpp"
+#include "FixedTimestep.hpp"
+#include "ThreadPool.hpp"
+#include "TurnPipeline.hpp"
+#include "TurnEvents.hpp"
+#include "Territory.hpp"
+#include "TileYieldCache.hpp"
+#include "Visibility.hpp"
+#include "Profiler.hpp"
+#include <SFML/System/Vector2.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+// Owns the game world and advances it on its own thread.
+// The render thread never touches the world directly; it draws the
+// snapshots published through getSnapshots(). Input handlers that need to
+// query or modify the world must hold getMutex() while doing so.
+class Simulation {
+private:
+    int mapWidth;
+    int mapHeight;
+    float hexSize;
+
+    std::vector<std::vector<game::Tile>> tileMap;
+
+    // Tile ownership, and the tiles each city works with their cached yields
+    Territory territory;
+    TileYieldCache tileYields;
+
+    // Fog of war
+    Visibility visibility;
+
+    // All entities; the managers below are facades over it
+    World world;
+    UnitManager unitManager;
+    game::CityManager cityManager;
+    GameManager gameManager;
+
+    // Turn clock
+    float turnLength;
+    float turnTimer;
+    int turnNumber;
+    std::uint64_t tickCount;
+
+    // Stages run each time the turn clock runs out
+    TurnPipeline turnPipeline;
+    TurnEvents turnEvents;
+
+    // World generation; seeded so runs can be reproduced
+    std::mt19937 rng;
+
+    // Scratch buffers for the movement system
+    MovementBatch movementBatch;
+
+    // Scratch list for proximity queries while building snapshots
+    std::vector<Entity> nearbyCities;
+
+    // Worker threads for per-turn work; the simulation thread joins in
+    std::unique_ptr<ThreadPool> workerPool;
+
+    // Scoped timers for each tick, when a profiler is attached
+    struct ProfileScopes {
+        Profiler::ScopeId tick = 0;
+        Profiler::ScopeId territory = 0;
+        Profiler::ScopeId turn = 0;
+        Profiler::ScopeId gameManager = 0;
+        Profiler::ScopeId movement = 0;
+        Profiler::ScopeId visibility = 0;
+    };
+    Profiler::Track* profileTrack;
+    ProfileScopes profileScopes;
+
+    // Threading
+    std::mutex worldMutex;
+    SnapshotBuffer snapshots;
+    std::thread thread;
+    std::atomic<bool> running;
+    std::atomic<bool> worldActive;
+    std::atomic<bool> turnClockActive;
+
+    // Fixed simulation step, independent of the render frame rate
+    FixedTimestep timestep;
+    std::chrono::steady_clock::time_point lastTickTime;
+
+    void buildTurnPipeline();
+    void generateMap();
+    void placeStartingEntities();
+    void run();
+
+public:
+    Simulation(int width, int height, float hexSize, float tickRate = 60.0f);
+    ~Simulation();
+
+    Simulation(const Simulation&) = delete;
+    Simulation& operator=(const Simulation&) = delete;
+
+    // Seed map generation and city spawning; call before initialize()
+    void setSeed(unsigned int seed);
+
+    // Build the map and place the starting units, cities and hero
+    void initialize();
+
+    // Thread control
+    void start();
+    void stop();
+
+    // World lock for input handlers running on the main thread
+    std::mutex& getMutex() { return worldMutex; }
+
+    // worldActive: units move (any in-game state)
+    // turnClockActive: the turn timer counts down (plain Playing state)
+    void setActivity(bool worldActive, bool turnClockActive);
+
+    // Extra threads for turn processing; set before start()
+    void setWorkerThreads(unsigned int count);
+    unsigned int getThreadCount() const { return workerPool->getThreadCount(); }
+
+    // Record tick timings on a "simulation" track; set before start()
+    void setProfiler(Profiler& profiler);
+
+    // Simulation ticks per second; set before start()
+    void setTickRate(float ticksPerSecond) { timestep.setTickRate(ticksPerSecond); }
+    float getTickDuration() const { return timestep.getTickDuration(); }
+
+    // Advance the world by one fixed tick; caller must hold getMutex()
+    void tick();
+
+    // Advance the world by an arbitrary step; caller must hold getMutex()
+    void update(float deltaTime);
+
+    // Fill a snapshot from the current world state; caller must hold getMutex()
+    void buildSnapshot(RenderSnapshot& snapshot);
+
+    SnapshotBuffer& getSnapshots() { return snapshots; }
+
+    // World access; hold getMutex() while using these once start() was called
+    std::vector<std::vector<game::Tile>>& getTileMap() { return tileMap; }
+    World& getWorld() { return world; }
+    const Territory& getTerritory() const { return territory; }
+    const TileYieldCache& getTileYields() const { return tileYields; }
+    const Visibility& getVisibility() const { return visibility; }
+    UnitManager& getUnitManager() { return unitManager; }
+    game::CityManager& getCityManager() { return cityManager; }
+    GameManager& getGameManager() { return gameManager; }
+
+    // Per-stage turn timings; hold getMutex() once start() was called
+    TurnPipeline& getTurnPipeline() { return turnPipeline; }
+
+    // What happened during the last turn
+    const TurnEvents& getTurnEvents() const { return turnEvents; }
+
+    int getTurnNumber() const { return turnNumber; }
+    std::uint64_t getTickCount() const { return tickCount; }
+
+    int getMapWidth() const { return mapWidth; }
+    int getMapHeight() const { return mapHeight; }
+
+    // Tile whose row and column best match a world position, clamped to the map.
+    // Exact for tile centers, which is where units come to rest.
+    sf::Vector2i worldToTile(const sf::Vector2f& position) const;
+
+    // First city within radius of a position, or an invalid entity
+    Entity findCityNear(const sf::Vector2f& position, float radius) const;
+
+    // Distance at which the hero can enter a city
+    float getCityInteractionRadius() const { return hexSize * 3.5f; }
+};
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// Generational handle into a SlotMap.
+// The generation changes every time a slot is reused, so a handle to an
+// erased element never resolves to whatever took its place.
+struct Handle {
+    static constexpr std::uint32_t INVALID_INDEX = 0xFFFFFFFFu;
+
+    std::uint32_t index = INVALID_INDEX;
+    std::uint32_t generation = 0;
+
+    bool isValid() const { return index != INVALID_INDEX; }
+
+    bool operator==(const Handle& other) const {
+        return index == other.index && generation == other.generation;
+    }
+    bool operator!=(const Handle& other) const { return !(*this == other); }
+};
+
+// Dense container addressed by stable handles.
+// Insert, erase and lookup are O(1). Values stay contiguous: erase moves the
+// last value into the hole, and only the slot table knows where each value
+// lives, so handles survive both reallocation and removal of other values.
+template <typename T>
+class SlotMap {
+private:
+    static constexpr std::uint32_t NONE = 0xFFFFFFFFu;
+
+    // Slot table, indexed by Handle::index
+    struct Slot {
+        std::uint32_t dense = NONE;     // Position in values, or next free slot when unused
+        std::uint32_t generation = 0;
+        bool used = false;
+    };
+
+    std::vector<Slot> slots;
+    std::uint32_t freeHead = NONE;
+
+    // Dense storage; owners[i] is the handle of values[i]
+    std::vector<T> values;
+    std::vector<Handle> owners;
+
+public:
+    template <typename... Args>
+    Handle insert(Args&&... args) {
+        std::uint32_t index;
+        if (freeHead != NONE) {
+            index = freeHead;
+            freeHead = slots[index].dense;
+        } else {
+            index = static_cast<std::uint32_t>(slots.size());
+            slots.emplace_back();
+        }
+
+        Slot& slot = slots[index];
+        slot.dense = static_cast<std::uint32_t>(values.size());
+        slot.used = true;
+
+        Handle handle{index, slot.generation};
+        values.emplace_back(std::forward<Args>(args)...);
+        owners.push_back(handle);
+        return handle;
+    }
+
+    // Returns false if the handle was stale or invalid
+    bool erase(Handle handle) {
+        if (!contains(handle)) return false;
+
+        Slot& slot = slots[handle.index];
+        std::uint32_t last = static_cast<std::uint32_t>(values.size() - 1);
+        if (slot.dense != last) {
+            values[slot.dense] = std::move(values[last]);
+            owners[slot.dense] = owners[last];
+            slots[owners[slot.dense].index].dense = slot.dense;
+        }
+        values.pop_back();
+        owners.pop_back();
+
+        ++slot.generation;
+        slot.used = false;
+        slot.dense = freeHead;
+        freeHead = handle.index;
+        return true;
+    }
+
+    bool contains(Handle handle) const {
+        return handle.index < slots.size() &&
+               slots[handle.index].used &&
+               slots[handle.index].generation == handle.generation;
+    }
+
+    T* get(Handle handle) {
+        return contains(handle) ? &values[slots[handle.index].dense] : nullptr;
+    }
+
+    const T* get(Handle handle) const {
+        return contains(handle) ? &values[slots[handle.index].dense] : nullptr;
+    }
+
+    void clear() {
+        // Bump every live slot so outstanding handles go stale
+        while (!owners.empty()) {
+            erase(owners.back());
+        }
+    }
+
+    std::size_t size() const { return values.size(); }
+    bool empty() const { return values.empty(); }
+
+    // Dense access; order changes when values are erased
+    std::vector<T>& data() { return values; }
+    const std::vector<T>& data() const { return values; }
+    const std::vector<Handle>& handles() const { return owners; }
+    Handle handleAt(std::size_t i) const { return owners[i]; }
+};
@@ -0,0 +1,61 @@
+#include "SpatialHash.hpp"
+#include <algorithm>
+
+SpatialHash::SpatialHash(float size)
+    : cellSize(size), minCell(0, 0), maxCell(0, 0), hasBounds(false) {
+}
+
+void SpatialHash::update(Entity entity, const sf::Vector2f& position) {
+    sf::Vector2i cell = cellOf(position);
+    std::uint64_t cellKey = key(cell.x, cell.y);
+
+    std::uint64_t* current = entityCells.get(entity);
+    if (current) {
+        if (*current == cellKey) return;  // Still in the same cell
+        removeFromCell(*current, entity);
+        *current = cellKey;
+    } else {
+        entityCells.add(entity, cellKey);
+    }
+    cells[cellKey].push_back(entity);
+
+    if (!hasBounds) {
+        minCell = maxCell = cell;
+        hasBounds = true;
+    } else {
+        minCell.x = std::min(minCell.x, cell.x);
+        minCell.y = std::min(minCell.y, cell.y);
+        maxCell.x = std::max(maxCell.x, cell.x);
+        maxCell.y = std::max(maxCell.y, cell.y);
+    }
+}
+
+void SpatialHash::remove(Entity entity) {
+    const std::uint64_t* current = entityCells.get(entity);
+    if (!current) return;
+
+    removeFromCell(*current, entity);
+    entityCells.remove(entity);
+}
+
+void SpatialHash::clear() {
+    cells.clear();
+    entityCells.clear();
+    hasBounds = false;
+}
+
+void SpatialHash::removeFromCell(std::uint64_t cellKey, Entity entity) {
+    auto it = cells.find(cellKey);
+    if (it == cells.end()) return;
+
+    // Cells hold a handful of entities; swap-remove keeps this cheap.
+    // Emptied cells are kept so units walking back and forth don't reallocate.
+    std::vector<Entity>& occupants = it->second;
+    for (size_t i = 0; i < occupants.size(); ++i) {
+        if (occupants[i] == entity) {
+            occupants[i] = occupants.back();
+            occupants.pop_back();
+            break;
+        }
+    }
+}
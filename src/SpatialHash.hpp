@@ -0,0 +1,98 @@
+#pragma once
+
+#include "Ecs.hpp"
+#include <SFML/System/Vector2.hpp>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// Uniform grid of entity ids, keyed by cell.
+// Each entity is filed under the cell containing its position; moving within
+// a cell costs one lookup, crossing into another cell is an O(1) re-file.
+// Queries only return candidates from the overlapping cells; callers do the
+// exact distance or hit test against the real positions.
+class SpatialHash {
+private:
+    float cellSize;
+    std::unordered_map<std::uint64_t, std::vector<Entity>> cells;
+    ComponentPool<std::uint64_t> entityCells;  // Cell each entity is filed under
+
+    // Extent of every cell ever used, bounding ring searches
+    sf::Vector2i minCell;
+    sf::Vector2i maxCell;
+    bool hasBounds;
+
+    static std::uint64_t key(int cellX, int cellY) {
+        return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(cellX)) << 32) |
+               static_cast<std::uint32_t>(cellY);
+    }
+
+    void removeFromCell(std::uint64_t cellKey, Entity entity);
+
+public:
+    explicit SpatialHash(float cellSize = 64.0f);
+
+    float getCellSize() const { return cellSize; }
+
+    sf::Vector2i cellOf(const sf::Vector2f& position) const {
+        return sf::Vector2i(static_cast<int>(std::floor(position.x / cellSize)),
+                            static_cast<int>(std::floor(position.y / cellSize)));
+    }
+
+    // Insert the entity or re-file it after it moved
+    void update(Entity entity, const sf::Vector2f& position);
+    void remove(Entity entity);
+    void clear();
+
+    bool contains(Entity entity) const { return entityCells.has(entity); }
+    std::size_t size() const { return entityCells.size(); }
+
+    // Visit every entity filed in a cell overlapping the circle
+    template <typename Fn>
+    void forEachNear(const sf::Vector2f& center, float radius, Fn&& fn) const {
+        sf::Vector2i low = cellOf(sf::Vector2f(center.x - radius, center.y - radius));
+        sf::Vector2i high = cellOf(sf::Vector2f(center.x + radius, center.y + radius));
+        for (int x = low.x; x <= high.x; ++x) {
+            for (int y = low.y; y <= high.y; ++y) {
+                forEachInCell(x, y, fn);
+            }
+        }
+    }
+
+    // Visit every entity in the square ring of cells 'ring' steps around a cell.
+    // Returns false once the ring encloses every cell ever used, so neither it
+    // nor any larger ring can hold anything.
+    template <typename Fn>
+    bool forEachInRing(const sf::Vector2i& centerCell, int ring, Fn&& fn) const {
+        if (!hasBounds) return false;
+        if (centerCell.x - ring < minCell.x && centerCell.x + ring > maxCell.x &&
+            centerCell.y - ring < minCell.y && centerCell.y + ring > maxCell.y) {
+            return false;
+        }
+
+        if (ring == 0) {
+            forEachInCell(centerCell.x, centerCell.y, fn);
+            return true;
+        }
+        for (int x = centerCell.x - ring; x <= centerCell.x + ring; ++x) {
+            forEachInCell(x, centerCell.y - ring, fn);
+            forEachInCell(x, centerCell.y + ring, fn);
+        }
+        for (int y = centerCell.y - ring + 1; y <= centerCell.y + ring - 1; ++y) {
+            forEachInCell(centerCell.x - ring, y, fn);
+            forEachInCell(centerCell.x + ring, y, fn);
+        }
+        return true;
+    }
+
+    template <typename Fn>
+    void forEachInCell(int cellX, int cellY, Fn&& fn) const {
+        auto it = cells.find(key(cellX, cellY));
+        if (it == cells.end()) return;
+        for (Entity entity : it->second) {
+            fn(entity);
+        }
+    }
+};
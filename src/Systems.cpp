@@ -0,0 +1,74 @@
+#include "Systems.hpp"
+#include "AllocationTracker.hpp"
+
+namespace Systems {
+
+void storePreviousPositions(World& world) {
+    for (Position& position : world.positions.data()) {
+        position.previous = position.current;
+    }
+}
+
+void updateMovement(World& world, MovementBatch& batch, float deltaTime) {
+    // Gather everything with a path into the SoA batch
+    batch.clear();
+    auto& paths = world.paths.data();
+    for (size_t i = 0; i < paths.size(); ++i) {
+        Entity entity = world.paths.entityAt(i);
+        MovementPath& path = paths[i];
+        Position* position = world.positions.get(entity);
+        Movement* movement = world.movements.get(entity);
+        if (!position || !movement || path.next >= path.count) {
+            batch.finished.push_back(entity);
+            continue;
+        }
+        batch.add(MovementBatch::Link{entity, position, movement, &path}, world.pathPool.current(path));
+    }
+
+    // Advance all of them at once; the kernel only works on the batch arrays
+    {
+        NoAllocScope noAlloc("movement kernel");
+        MovementKernel::advance(batch, deltaTime);
+    }
+
+    // Write back, and move on to the next waypoint where one was reached
+    for (size_t i = 0; i < batch.size(); ++i) {
+        const MovementBatch::Link& link = batch.links[i];
+        link.position->current = sf::Vector2f(batch.posX[i], batch.posY[i]);
+        link.movement->movementPoints -= batch.moved[i];
+        world.spatialIndex.update(link.entity, link.position->current);
+
+        if (batch.arrived[i] && !world.pathPool.advance(*link.path)) {
+            batch.finished.push_back(link.entity);
+        }
+    }
+
+    // Pools are only modified once nothing points into them any more
+    for (Entity entity : batch.finished) {
+        world.removePath(entity);
+    }
+}
+
+void setPath(World& world, Entity entity, const std::vector<sf::Vector2f>& path) {
+    Position* position = world.positions.get(entity);
+    if (!position || path.size() < 2) {
+        world.removePath(entity);
+        return;
+    }
+
+    // Reuses the blocks of any path the entity was already following
+    MovementPath* movementPath = world.paths.get(entity);
+    if (!movementPath) {
+        movementPath = &world.paths.add(entity);
+    }
+    world.pathPool.assign(*movementPath, path);
+
+    if (Movement* movement = world.movements.get(entity)) {
+        movement->movementPoints = 100;  // Reset movement points
+    }
+
+    // Immediately align to first path point
+    world.setPosition(entity, path[0]);
+}
+
+} // namespace Systems
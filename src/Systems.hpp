@@ -0,0 +1,22 @@
+#pragma once
+
+#include "World.hpp"
+#include "MovementKernel.hpp"
+#include <SFML/System/Vector2.hpp>
+#include <vector>
+
+// Per-tick systems. Each one walks a dense component array of the World
+// instead of asking every entity object to update itself.
+namespace Systems {
+    // Remember where everything was before this tick moves it
+    void storePreviousPositions(World& world);
+
+    // Advance every entity with a path towards its next waypoint.
+    // Paths are removed once their last waypoint is reached.
+    // batch is scratch space, kept by the caller so its buffers are reused.
+    void updateMovement(World& world, MovementBatch& batch, float deltaTime);
+
+    // Start an entity along a path, snapping it to the first point.
+    // Paths with fewer than two points just stop the entity.
+    void setPath(World& world, Entity entity, const std::vector<sf::Vector2f>& path);
+}
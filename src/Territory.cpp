@@ -0,0 +1,210 @@
+#include "Territory.hpp"
+#include "HexGrid.hpp"
+#include "World.hpp"
+#include <algorithm>
+
+namespace {
+    // Border lines sit slightly inside their tile so two neighbouring
+    // owners both show along a shared side
+    const float BORDER_INSET = 0.9f;
+}
+
+Territory::Territory(const std::vector<std::vector<Tile>>& map, float size)
+    : tileMap(map),
+      width(0),
+      height(0),
+      hexSize(size),
+      searchStamp(0),
+      borderMesh(std::make_shared<BorderMesh>()),
+      version(0),
+      meshDirty(false)
+{
+}
+
+void Territory::reset() {
+    width = static_cast<int>(tileMap.size());
+    height = width > 0 ? static_cast<int>(tileMap[0].size()) : 0;
+
+    std::size_t tileCount = static_cast<std::size_t>(width) * height;
+    owner.assign(tileCount, Entity{});
+    distance.assign(tileCount, UNCLAIMED);
+    visited.assign(tileCount, 0);
+    searchStamp = 0;
+    cities.clear();
+
+    ++version;
+    meshDirty = true;
+}
+
+void Territory::sync(const World& world) {
+    // Removed cities free all their tiles
+    freedCenters.clear();
+    for (std::size_t i = cities.size(); i-- > 0;) {
+        Entity city = cities.entityAt(i);
+        if (world.cities.has(city)) continue;
+
+        CityTerritory& territory = cities.data()[i];
+        for (int index : territory.tiles) {
+            if (owner[index] == city) {
+                owner[index] = Entity{};
+                distance[index] = UNCLAIMED;
+            }
+        }
+        freedCenters.push_back(territory.center);
+        cities.remove(city);
+        meshDirty = true;
+    }
+
+    // Search from new cities, and from any city that could reach freed tiles.
+    // City order decides ties, so the result doesn't depend on timing.
+    sources.clear();
+    for (Entity city : world.cities.entities()) {
+        if (!cities.has(city)) {
+            CityTerritory& territory = cities.add(city);
+            territory.center = HexGrid::worldToTile(*world.getPosition(city), hexSize, width, height);
+            sources.push_back(city);
+            continue;
+        }
+
+        const sf::Vector2i& center = cities.get(city)->center;
+        for (const auto& freed : freedCenters) {
+            if (HexGrid::distance(center, freed) <= 2 * RADIUS + 1) {
+                sources.push_back(city);
+                break;
+            }
+        }
+    }
+
+    if (!sources.empty()) {
+        expandFrom(sources);
+    }
+    if (!sources.empty() || !freedCenters.empty()) {
+        refreshChangedCities();
+        ++version;
+    }
+}
+
+void Territory::claim(int index, Entity city, std::uint8_t steps) {
+    Entity previous = owner[index];
+    if (previous.isValid() && previous != city) {
+        if (CityTerritory* loser = cities.get(previous)) {
+            loser->changed = true;
+        }
+    }
+    owner[index] = city;
+    distance[index] = steps;
+    cities.get(city)->changed = true;
+}
+
+void Territory::expandFrom(const std::vector<Entity>& sourceCities) {
+    ++searchStamp;
+    frontier.clear();
+
+    for (Entity city : sourceCities) {
+        int index = tileIndex(cities.get(city)->center);
+        if (owner[index] != city && distance[index] == 0) continue;  // Another city's center
+
+        if (owner[index] != city) {
+            claim(index, city, 0);
+        }
+        visited[index] = searchStamp;
+        frontier.push_back(index);
+    }
+
+    // Level by level, so every tile is reached first from its closest source
+    for (int steps = 1; steps <= RADIUS && !frontier.empty(); ++steps) {
+        nextFrontier.clear();
+        for (int index : frontier) {
+            Entity city = owner[index];
+            sf::Vector2i tile = tileAt(index);
+            if (distance[index] > 0 && tileMap[tile.x][tile.y].type == TileType::Mountain) continue;
+
+            for (int direction = 0; direction < 6; ++direction) {
+                sf::Vector2i next = HexGrid::neighbor(tile, direction);
+                if (next.x < 0 || next.x >= width || next.y < 0 || next.y >= height) continue;
+
+                int nextIndex = tileIndex(next);
+                if (visited[nextIndex] == searchStamp) continue;
+
+                // Take unclaimed tiles and tiles closer to us than to their owner;
+                // keep walking through tiles we already own
+                if (!owner[nextIndex].isValid() || distance[nextIndex] > steps) {
+                    claim(nextIndex, city, static_cast<std::uint8_t>(steps));
+                } else if (owner[nextIndex] != city) {
+                    continue;
+                }
+                visited[nextIndex] = searchStamp;
+                nextFrontier.push_back(nextIndex);
+            }
+        }
+        frontier.swap(nextFrontier);
+    }
+}
+
+void Territory::refreshChangedCities() {
+    for (std::size_t i = 0; i < cities.size(); ++i) {
+        CityTerritory& territory = cities.data()[i];
+        if (!territory.changed) continue;
+
+        Entity city = cities.entityAt(i);
+        territory.tiles.clear();
+        HexGrid::forEachInRadius(territory.center, RADIUS, width, height, [&](const sf::Vector2i& tile) {
+            int index = tileIndex(tile);
+            if (owner[index] == city) {
+                territory.tiles.push_back(index);
+            }
+        });
+
+        rebuildEdges(city, territory);
+        ++territory.revision;
+        territory.changed = false;
+        meshDirty = true;
+    }
+}
+
+void Territory::rebuildEdges(Entity city, CityTerritory& territory) {
+    territory.edges.clear();
+    for (int index : territory.tiles) {
+        sf::Vector2i tile = tileAt(index);
+        const sf::Vector2f& center = tileMap[tile.x][tile.y].center;
+
+        for (int direction = 0; direction < 6; ++direction) {
+            if (getOwner(HexGrid::neighbor(tile, direction)) == city) continue;
+
+            BorderEdge edge;
+            edge.from = HexGrid::corner(center, hexSize * BORDER_INSET, (direction + 5) % 6);
+            edge.to = HexGrid::corner(center, hexSize * BORDER_INSET, direction);
+            edge.owner = city.index;
+            edge.tile = static_cast<std::uint32_t>(index);
+            territory.edges.push_back(edge);
+        }
+    }
+}
+
+Entity Territory::getOwner(int x, int y) const {
+    if (x < 0 || x >= width || y < 0 || y >= height) return Entity{};
+    return owner[tileIndex(sf::Vector2i(x, y))];
+}
+
+const std::vector<int>* Territory::getTiles(Entity city) const {
+    const CityTerritory* territory = cities.get(city);
+    return territory ? &territory->tiles : nullptr;
+}
+
+std::uint32_t Territory::getRevision(Entity city) const {
+    const CityTerritory* territory = cities.get(city);
+    return territory ? territory->revision : 0;
+}
+
+std::shared_ptr<const BorderMesh> Territory::getBorderMesh() {
+    if (meshDirty) {
+        auto mesh = std::make_shared<BorderMesh>();
+        mesh->version = version;
+        for (const auto& territory : cities.data()) {
+            mesh->edges.insert(mesh->edges.end(), territory.edges.begin(), territory.edges.end());
+        }
+        borderMesh = std::move(mesh);
+        meshDirty = false;
+    }
+    return borderMesh;
+}
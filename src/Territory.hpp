@@ -0,0 +1,102 @@
+#pragma once
+
+#include "Ecs.hpp"
+#include "GameEntities.hpp"
+#include <SFML/System/Vector2.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class World;
+
+// One side of a hex where the owner changes
+struct BorderEdge {
+    sf::Vector2f from;
+    sf::Vector2f to;
+    std::uint32_t owner;  // Entity index of the owning city; picks the color
+    std::uint32_t tile;   // Owned tile (q * height + r) this side belongs to
+};
+
+// Border lines for the whole map. Immutable once built, so the render
+// thread can hold on to it while the simulation builds the next one.
+struct BorderMesh {
+    std::uint64_t version = 0;
+    std::vector<BorderEdge> edges;
+};
+
+// Which city owns each tile.
+// Ownership spreads from each city center by breadth-first search, up to
+// RADIUS steps; mountains can be claimed but the search doesn't pass them.
+// A tile goes to the closest city, and on a tie to the city that got there
+// first. Founding a city only searches around it, and removing one only
+// refills the area its neighbours can reach.
+class Territory {
+public:
+    static constexpr int RADIUS = 3;
+
+private:
+    static constexpr std::uint8_t UNCLAIMED = 0xFF;
+
+    struct CityTerritory {
+        sf::Vector2i center;
+        std::vector<int> tiles;          // Tile indices owned
+        std::vector<BorderEdge> edges;   // Sides of owned tiles facing other owners
+        std::uint32_t revision = 0;      // Bumped whenever tiles change
+        bool changed = true;
+    };
+
+    const std::vector<std::vector<Tile>>& tileMap;
+    int width;
+    int height;
+    float hexSize;
+
+    std::vector<Entity> owner;           // Per tile, q * height + r
+    std::vector<std::uint8_t> distance;  // Steps from the owner's center
+    ComponentPool<CityTerritory> cities;
+
+    // Scratch for the search
+    std::vector<int> frontier;
+    std::vector<int> nextFrontier;
+    std::vector<Entity> sources;
+    std::vector<sf::Vector2i> freedCenters;
+    std::vector<std::uint32_t> visited;  // Tile was reached in search number searchStamp
+    std::uint32_t searchStamp;
+
+    std::shared_ptr<const BorderMesh> borderMesh;
+    std::uint64_t version;
+    bool meshDirty;
+
+    int tileIndex(const sf::Vector2i& tile) const { return tile.x * height + tile.y; }
+    sf::Vector2i tileAt(int index) const { return sf::Vector2i(index / height, index % height); }
+
+    // Multi-source search from the given cities' centers
+    void expandFrom(const std::vector<Entity>& sourceCities);
+    void claim(int index, Entity city, std::uint8_t steps);
+    void refreshChangedCities();
+    void rebuildEdges(Entity city, CityTerritory& territory);
+
+public:
+    Territory(const std::vector<std::vector<Tile>>& tileMap, float hexSize);
+
+    // Size the per-tile arrays to the map and forget all cities
+    void reset();
+
+    // Pick up founded and removed cities. Cheap when nothing changed.
+    void sync(const World& world);
+
+    // O(1) ownership queries; invalid entity for unclaimed or off-map tiles
+    Entity getOwner(int x, int y) const;
+    Entity getOwner(const sf::Vector2i& tile) const { return getOwner(tile.x, tile.y); }
+
+    // Tiles a city owns; nullptr for unknown cities
+    const std::vector<int>* getTiles(Entity city) const;
+
+    // Changes whenever the city gains or loses tiles; 0 for unknown cities
+    std::uint32_t getRevision(Entity city) const;
+
+    // Border lines, rebuilt only after ownership changed
+    std::shared_ptr<const BorderMesh> getBorderMesh();
+
+    std::uint64_t getVersion() const { return version; }
+};
@@ -0,0 +1,117 @@
+#include "ThreadPool.hpp"
+#include <algorithm>
+
+ThreadPool::ThreadPool(unsigned int workerCount)
+    : jobGeneration(0), stopping(false), pendingRanges(0) {
+    for (unsigned int i = 0; i <= workerCount; ++i) {
+        queues.push_back(std::make_unique<Queue>());
+    }
+    for (unsigned int i = 1; i <= workerCount; ++i) {
+        workers.emplace_back(&ThreadPool::workerLoop, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        stopping = true;
+    }
+    wakeCondition.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+unsigned int ThreadPool::defaultWorkerCount() {
+    unsigned int hardwareThreads = std::thread::hardware_concurrency();
+    return hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+}
+
+void ThreadPool::parallelFor(std::size_t count, std::size_t grainSize, const RangeFunction& function) {
+    if (count == 0) return;
+    grainSize = std::max<std::size_t>(grainSize, 1);
+
+    // Not worth waking anyone up
+    if (workers.empty() || count <= grainSize) {
+        function(0, count, 0);
+        return;
+    }
+
+    // Deal contiguous runs of ranges to each queue so neighbouring indices
+    // tend to stay on one thread; stealing fixes any imbalance
+    const std::size_t rangeCount = (count + grainSize - 1) / grainSize;
+    const std::size_t threadCount = queues.size();
+    pendingRanges = rangeCount;
+    for (std::size_t t = 0; t < threadCount; ++t) {
+        std::size_t first = rangeCount * t / threadCount;
+        std::size_t last = rangeCount * (t + 1) / threadCount;
+
+        std::lock_guard<std::mutex> lock(queues[t]->mutex);
+        for (std::size_t r = first; r < last; ++r) {
+            std::size_t begin = r * grainSize;
+            queues[t]->ranges.push_back(Range{begin, std::min(begin + grainSize, count), &function});
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        ++jobGeneration;
+    }
+    wakeCondition.notify_all();
+
+    runRanges(0);
+
+    std::unique_lock<std::mutex> lock(doneMutex);
+    doneCondition.wait(lock, [this] { return pendingRanges.load() == 0; });
+}
+
+bool ThreadPool::takeRange(unsigned int threadIndex, Range& range) {
+    // Own queue first, from the front
+    {
+        Queue& own = *queues[threadIndex];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.ranges.empty()) {
+            range = own.ranges.front();
+            own.ranges.pop_front();
+            return true;
+        }
+    }
+
+    // Then steal from the back of the others
+    const std::size_t threadCount = queues.size();
+    for (std::size_t offset = 1; offset < threadCount; ++offset) {
+        Queue& victim = *queues[(threadIndex + offset) % threadCount];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.ranges.empty()) {
+            range = victim.ranges.back();
+            victim.ranges.pop_back();
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::runRanges(unsigned int threadIndex) {
+    Range range;
+    while (takeRange(threadIndex, range)) {
+        (*range.function)(range.begin, range.end, threadIndex);
+
+        if (pendingRanges.fetch_sub(1) == 1) {
+            std::lock_guard<std::mutex> lock(doneMutex);
+            doneCondition.notify_all();
+        }
+    }
+}
+
+void ThreadPool::workerLoop(unsigned int threadIndex) {
+    std::uint64_t seenGeneration = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(wakeMutex);
+            wakeCondition.wait(lock, [&] { return stopping || jobGeneration != seenGeneration; });
+            if (stopping) return;
+            seenGeneration = jobGeneration;
+        }
+        runRanges(threadIndex);
+    }
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed set of worker threads running parallel-for loops.
+// Each thread owns a queue of index ranges; a thread that runs dry steals
+// from the back of another thread's queue, so uneven chunks even out.
+// The calling thread always takes part as thread 0.
+// parallelFor is not reentrant: don't call it from inside a loop body.
+class ThreadPool {
+public:
+    // fn(begin, end, threadIndex); threadIndex is in [0, getThreadCount())
+    using RangeFunction = std::function<void(std::size_t, std::size_t, unsigned int)>;
+
+private:
+    struct Range {
+        std::size_t begin;
+        std::size_t end;
+        const RangeFunction* function;
+    };
+
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Range> ranges;
+    };
+
+    std::vector<std::unique_ptr<Queue>> queues;  // One per thread, caller first
+    std::vector<std::thread> workers;
+
+    std::mutex wakeMutex;
+    std::condition_variable wakeCondition;
+    std::uint64_t jobGeneration;
+    bool stopping;
+
+    std::atomic<std::size_t> pendingRanges;
+    std::mutex doneMutex;
+    std::condition_variable doneCondition;
+
+    bool takeRange(unsigned int threadIndex, Range& range);
+    void runRanges(unsigned int threadIndex);
+    void workerLoop(unsigned int threadIndex);
+
+public:
+    // workerCount extra threads besides the caller; 0 runs everything inline
+    explicit ThreadPool(unsigned int workerCount = defaultWorkerCount());
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // One worker per hardware thread, minus the caller
+    static unsigned int defaultWorkerCount();
+
+    // Threads taking part in a parallelFor, including the caller
+    unsigned int getThreadCount() const { return static_cast<unsigned int>(workers.size()) + 1; }
+
+    // Split [0, count) into ranges of at most grainSize and run them across
+    // all threads. Returns once every range has finished.
+    void parallelFor(std::size_t count, std::size_t grainSize, const RangeFunction& function);
+};
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <algorithm>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// One bit per map tile, packed 64 to a word. Indexed like the other
+// per-tile arrays: q * mapHeight + r.
+class TileBitset {
+private:
+    std::vector<std::uint64_t> words;
+    std::size_t bitCount = 0;
+
+public:
+    // Resize to bits tiles, all cleared
+    void resize(std::size_t bits) {
+        bitCount = bits;
+        words.assign((bits + 63) / 64, 0);
+    }
+
+    std::size_t size() const { return bitCount; }
+    bool empty() const { return bitCount == 0; }
+
+    bool test(std::size_t i) const { return (words[i >> 6] >> (i & 63)) & 1u; }
+    void set(std::size_t i) { words[i >> 6] |= std::uint64_t(1) << (i & 63); }
+    void reset(std::size_t i) { words[i >> 6] &= ~(std::uint64_t(1) << (i & 63)); }
+
+    void clear() { std::fill(words.begin(), words.end(), 0); }
+
+    // Set every tile; bits past size() stay clear so count() is exact
+    void setAll() {
+        std::fill(words.begin(), words.end(), ~std::uint64_t(0));
+        if (bitCount & 63) {
+            words.back() = (std::uint64_t(1) << (bitCount & 63)) - 1;
+        }
+    }
+
+    bool any() const {
+        for (std::uint64_t word : words) {
+            if (word) return true;
+        }
+        return false;
+    }
+
+    std::size_t count() const {
+        std::size_t total = 0;
+        for (std::uint64_t word : words) {
+            total += std::bitset<64>(word).count();
+        }
+        return total;
+    }
+
+    // Whole-word set operations; both sides must be the same size
+    TileBitset& operator|=(const TileBitset& other) {
+        for (std::size_t i = 0; i < words.size(); ++i) {
+            words[i] |= other.words[i];
+        }
+        return *this;
+    }
+
+    TileBitset& operator&=(const TileBitset& other) {
+        for (std::size_t i = 0; i < words.size(); ++i) {
+            words[i] &= other.words[i];
+        }
+        return *this;
+    }
+
+    // Clear every tile set in other
+    TileBitset& subtract(const TileBitset& other) {
+        for (std::size_t i = 0; i < words.size(); ++i) {
+            words[i] &= ~other.words[i];
+        }
+        return *this;
+    }
+
+    const std::vector<std::uint64_t>& getWords() const { return words; }
+};
@@ -0,0 +1,100 @@
+#include "TileYieldCache.hpp"
+#include "HexGrid.hpp"
+#include "Territory.hpp"
+#include "World.hpp"
+#include <algorithm>
+
+TileYieldCache::TileYieldCache(const std::vector<std::vector<Tile>>& map, const Territory& cityTerritory, float size)
+    : tileMap(map),
+      territory(cityTerritory),
+      width(0),
+      height(0),
+      hexSize(size),
+      rebuildCount(0)
+{
+}
+
+void TileYieldCache::reset() {
+    width = static_cast<int>(tileMap.size());
+    height = width > 0 ? static_cast<int>(tileMap[0].size()) : 0;
+    cities.clear();
+}
+
+void TileYieldCache::sync(const World& world) {
+    // Forget cities that are gone
+    for (std::size_t i = cities.size(); i-- > 0;) {
+        Entity city = cities.entityAt(i);
+        if (!world.cities.has(city)) {
+            cities.remove(city);
+        }
+    }
+
+    for (Entity city : world.cities.entities()) {
+        WorkedTiles* worked = cities.get(city);
+        if (!worked) {
+            worked = &cities.add(city);
+            worked->center = HexGrid::worldToTile(*world.getPosition(city), hexSize, width, height);
+        }
+
+        std::uint32_t revision = territory.getRevision(city);
+        if (!worked->collected || worked->territoryRevision != revision) {
+            collectTiles(city, *worked);
+            rebuildTotals(*worked);
+            worked->territoryRevision = revision;
+            worked->collected = true;
+            ++rebuildCount;
+        }
+    }
+}
+
+TileYield TileYieldCache::getYield(Entity city, int workers) const {
+    const WorkedTiles* worked = cities.get(city);
+    if (!worked || worked->bestTotals.empty()) return TileYield{};
+
+    std::size_t n = std::min(static_cast<std::size_t>(std::max(workers, 0)), worked->bestTotals.size() - 1);
+    return worked->bestTotals[n];
+}
+
+const std::vector<int>* TileYieldCache::getWorkedTiles(Entity city) const {
+    const WorkedTiles* worked = cities.get(city);
+    return worked ? &worked->tiles : nullptr;
+}
+
+void TileYieldCache::collectTiles(Entity city, WorkedTiles& worked) {
+    worked.tiles.clear();
+
+    // The center is always worked, whoever owns it
+    int centerIndex = tileIndex(worked.center);
+    worked.tiles.push_back(centerIndex);
+
+    HexGrid::forEachInRadius(worked.center, WORK_RADIUS, width, height, [&](const sf::Vector2i& tile) {
+        int index = tileIndex(tile);
+        if (index != centerIndex && territory.getOwner(tile) == city) {
+            worked.tiles.push_back(index);
+        }
+    });
+}
+
+void TileYieldCache::rebuildTotals(WorkedTiles& worked) {
+    // Best tiles first; ties go to food, then to the lower index
+    auto score = [](const TileYield& yield) { return yield.food + yield.production + yield.gold; };
+    auto yieldOf = [this](int index) {
+        sf::Vector2i tile = tileAt(index);
+        return tileMap[tile.x][tile.y].getYield();
+    };
+
+    std::sort(worked.tiles.begin() + 1, worked.tiles.end(), [&](int a, int b) {
+        TileYield ya = yieldOf(a);
+        TileYield yb = yieldOf(b);
+        if (score(ya) != score(yb)) return score(ya) > score(yb);
+        if (ya.food != yb.food) return ya.food > yb.food;
+        return a < b;
+    });
+
+    worked.bestTotals.clear();
+    TileYield total;
+    for (int index : worked.tiles) {
+        total += yieldOf(index);
+        worked.bestTotals.push_back(total);
+    }
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Ecs.hpp"
+#include "GameEntities.hpp"
+#include <SFML/System/Vector2.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class World;
+class Territory;
+
+// Which tiles each city works and what they yield.
+// A city works the tiles it owns within WORK_RADIUS of its center. Per city,
+// the yields of those tiles are kept as running totals, best tiles first, so
+// looking up what a city with n citizens produces is O(1). Nothing is
+// recomputed unless the city's territory changes.
+class TileYieldCache {
+public:
+    static constexpr int WORK_RADIUS = 2;
+
+private:
+    struct WorkedTiles {
+        sf::Vector2i center;
+        std::vector<int> tiles;               // Tile indices, center first
+        std::vector<TileYield> bestTotals;    // [n] = center plus the n best other tiles
+        std::uint32_t territoryRevision = 0;  // Territory::getRevision when last collected
+        bool collected = false;
+    };
+
+    const std::vector<std::vector<Tile>>& tileMap;
+    const Territory& territory;
+    int width;
+    int height;
+    float hexSize;
+
+    ComponentPool<WorkedTiles> cities;
+    std::size_t rebuildCount;
+
+    int tileIndex(const sf::Vector2i& tile) const { return tile.x * height + tile.y; }
+    sf::Vector2i tileAt(int index) const { return sf::Vector2i(index / height, index % height); }
+
+    void collectTiles(Entity city, WorkedTiles& worked);
+    void rebuildTotals(WorkedTiles& worked);
+
+public:
+    TileYieldCache(const std::vector<std::vector<Tile>>& tileMap, const Territory& territory, float hexSize);
+
+    // Take the map size and forget all cities
+    void reset();
+
+    // Pick up founded and removed cities and territory changes; call after
+    // Territory::sync
+    void sync(const World& world);
+
+    // What a city yields with workers citizens on its best tiles,
+    // on top of the center tile. Zero for unknown cities.
+    TileYield getYield(Entity city, int workers) const;
+
+    // Tiles a city works, center first; nullptr for unknown cities
+    const std::vector<int>* getWorkedTiles(Entity city) const;
+
+    // How many city rebuilds have happened; for profiling
+    std::size_t getRebuildCount() const { return rebuildCount; }
+};
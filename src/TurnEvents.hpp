@@ -0,0 +1,34 @@
+#pragma once
+
+#include "City.hpp"
+#include "Ecs.hpp"
+#include "GameEntities.hpp"
+#include <SFML/System/Vector2.hpp>
+#include <cstdint>
+#include <vector>
+
+// A city finished training a unit
+struct UnitSpawnedEvent {
+    Entity city;
+    UnitType type;
+    sf::Vector2f position;  // Where the city stands
+    std::uint8_t faction;   // The unit joins the city's faction
+};
+
+// A city finished constructing a building
+struct BuildingAddedEvent {
+    Entity city;
+    game::GameCity::BuildingType building;
+};
+
+// Everything that happened during one turn, one list per event type.
+// Stages append in city order and later stages consume whole lists at once.
+struct TurnEvents {
+    std::vector<UnitSpawnedEvent> unitsSpawned;
+    std::vector<BuildingAddedEvent> buildingsAdded;
+
+    void clear() {
+        unitsSpawned.clear();
+        buildingsAdded.clear();
+    }
+};
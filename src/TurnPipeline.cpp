@@ -0,0 +1,52 @@
+#include "TurnPipeline.hpp"
+#include "Log.hpp"
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+
+TurnPipeline::TurnPipeline()
+    : lastTurnMilliseconds(0.0),
+      turnsRun(0),
+      logTimings(true)
+{
+}
+
+void TurnPipeline::addStage(const std::string& name, StageFunction function) {
+    stages.push_back(std::move(function));
+    StageTiming timing;
+    timing.name = name;
+    timings.push_back(timing);
+}
+
+void TurnPipeline::run(TurnContext& context) {
+    using Clock = std::chrono::steady_clock;
+
+    auto turnStart = Clock::now();
+    for (size_t i = 0; i < stages.size(); ++i) {
+        auto stageStart = Clock::now();
+        stages[i](context);
+        double milliseconds = std::chrono::duration<double, std::milli>(Clock::now() - stageStart).count();
+
+        StageTiming& timing = timings[i];
+        timing.lastMilliseconds = milliseconds;
+        timing.totalMilliseconds += milliseconds;
+        timing.maxMilliseconds = std::max(timing.maxMilliseconds, milliseconds);
+    }
+    lastTurnMilliseconds = std::chrono::duration<double, std::milli>(Clock::now() - turnStart).count();
+    ++turnsRun;
+
+    if (logTimings) {
+        LOG_INFO("turn", "Turn {}: {}", context.turnNumber, formatLastTurn());
+    }
+}
+
+std::string TurnPipeline::formatLastTurn() const {
+    std::ostringstream line;
+    line << std::fixed << std::setprecision(3);
+    for (const auto& timing : timings) {
+        line << timing.name << " " << timing.lastMilliseconds << " ms | ";
+    }
+    line << "total " << lastTurnMilliseconds << " ms";
+    return line.str();
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+class ThreadPool;
+struct TurnEvents;
+
+// What a turn stage gets to work with
+struct TurnContext {
+    ThreadPool& pool;    // Stages may parallelFor over their own data
+    TurnEvents& events;  // Emitted by earlier stages, consumed by later ones
+    int turnNumber;
+    float deltaTime;
+};
+
+// Ordered list of named stages run once per turn. Each stage finishes
+// before the next starts and is timed on its own, so a slow turn can be
+// traced to the phase that caused it.
+class TurnPipeline {
+public:
+    using StageFunction = std::function<void(TurnContext&)>;
+
+    struct StageTiming {
+        std::string name;
+        double lastMilliseconds = 0.0;
+        double totalMilliseconds = 0.0;
+        double maxMilliseconds = 0.0;
+    };
+
+private:
+    std::vector<StageFunction> stages;
+    std::vector<StageTiming> timings;  // Parallel to stages
+    double lastTurnMilliseconds;
+    std::uint64_t turnsRun;
+    bool logTimings;
+
+public:
+    TurnPipeline();
+
+    // Stages run in the order they were added
+    void addStage(const std::string& name, StageFunction function);
+
+    // Run every stage once and record how long each took
+    void run(TurnContext& context);
+
+    // Print one line per turn with each stage's time
+    void setLogTimings(bool enabled) { logTimings = enabled; }
+
+    const std::vector<StageTiming>& getTimings() const { return timings; }
+    double getLastTurnMilliseconds() const { return lastTurnMilliseconds; }
+    std::uint64_t getTurnsRun() const { return turnsRun; }
+
+    // "production 0.12 ms | growth 0.05 ms | total 0.17 ms" for the last turn
+    std::string formatLastTurn() const;
+};
@@ -1,57 +1,60 @@
 #include "UIManager.hpp"
 #include "City.hpp"  // Include full definition of GameCity
+#include "Definitions.hpp"
 #include "HeroesGraphics.hpp"  // Add Heroes of Might and Magic 3 style graphics
 #include <iostream>
 
 UIManager::UIManager(unsigned int windowWidth, unsigned int windowHeight) 
-    : fontLoaded(false), 
+    : font(&placeholderFont),
+      fontLoaded(false),
+      menuLoading(false),
       showModal(false),
       showCityPanel(false),
       showHeroPanel(false),
       showArmyPanel(false),
       showMerchantPanel(false),
-      // Initialize all sf::Text objects with dummy font - will be properly set in initialize()
-      resourceTitle(font, ""),
-      foodText(font, ""),
-      woodText(font, ""),
-      stoneText(font, ""),
-      goldText(font, ""),
-      unitTitle(font, ""),
-      unitTypeText(font, ""),
-      unitHealthText(font, ""),
-      unitMovementText(font, ""),
-      unitActionText(font, ""),
-      cityTitle(font, ""),
-      cityPopulation(font, ""),
-      cityFood(font, ""),
-      cityProduction(font, ""),
-      cityGold(font, ""),
-      settlerText(font, ""),
-      warriorText(font, ""),
-      builderText(font, ""),
-      buildingText(font, ""),
-      heroTitle(font, ""),
-      heroLevel(font, ""),
-      heroExp(font, ""),
-      heroGold(font, ""),
-      heroAttributes(font, ""),
-      inventoryTitle(font, ""),
-      skillTitle(font, ""),
-      armyTitle(font, ""),
-      armyCounts(font, ""),
-      merchantTitle(font, ""),
-      merchantDescription(font, ""),
-      shopItemsTitle(font, ""),
-      shopUnitsTitle(font, ""),
-      backText(font, ""),
-      heroButtonText(font, ""),
-      armyButtonText(font, ""),
-      modalTitle(font, ""),
-      modalContent(font, ""),
-      closeButton(font, ""),
-      titleText(font, ""),
-      startText(font, ""),
-      notificationText(font, "", 14)
+      // Initialize all sf::Text objects with the placeholder font - will be properly set in initialize()
+      resourceTitle(placeholderFont, ""),
+      foodText(placeholderFont, ""),
+      woodText(placeholderFont, ""),
+      stoneText(placeholderFont, ""),
+      goldText(placeholderFont, ""),
+      unitTitle(placeholderFont, ""),
+      unitTypeText(placeholderFont, ""),
+      unitHealthText(placeholderFont, ""),
+      unitMovementText(placeholderFont, ""),
+      unitActionText(placeholderFont, ""),
+      cityTitle(placeholderFont, ""),
+      cityPopulation(placeholderFont, ""),
+      cityFood(placeholderFont, ""),
+      cityProduction(placeholderFont, ""),
+      cityGold(placeholderFont, ""),
+      settlerText(placeholderFont, ""),
+      warriorText(placeholderFont, ""),
+      builderText(placeholderFont, ""),
+      buildingText(placeholderFont, ""),
+      heroTitle(placeholderFont, ""),
+      heroLevel(placeholderFont, ""),
+      heroExp(placeholderFont, ""),
+      heroGold(placeholderFont, ""),
+      heroAttributes(placeholderFont, ""),
+      inventoryTitle(placeholderFont, ""),
+      skillTitle(placeholderFont, ""),
+      armyTitle(placeholderFont, ""),
+      armyCounts(placeholderFont, ""),
+      merchantTitle(placeholderFont, ""),
+      merchantDescription(placeholderFont, ""),
+      shopItemsTitle(placeholderFont, ""),
+      shopUnitsTitle(placeholderFont, ""),
+      backText(placeholderFont, ""),
+      heroButtonText(placeholderFont, ""),
+      armyButtonText(placeholderFont, ""),
+      modalTitle(placeholderFont, ""),
+      modalContent(placeholderFont, ""),
+      closeButton(placeholderFont, ""),
+      titleText(placeholderFont, ""),
+      startText(placeholderFont, ""),
+      notificationText(placeholderFont, "", 14)
 {
     // Initialize views
     gameView.setCenter(sf::Vector2f(0.f, 0.f));
@@ -177,227 +180,207 @@ UIManager::~UIManager() {
     // No dynamic allocations to clean up
 }
 
-bool UIManager::initialize() {
-    // Try different possible paths to find the font
-    const std::vector<std::string> fontPaths = {
-        "arial.ttf",                  // Current directory
-        "../assets/arial.ttf",        // Parent directory's assets folder
-        "assets/arial.ttf",           // Assets folder in current directory
-        "../fonts/OpenSans-Regular.ttf", // Parent directory's fonts folder
-        "fonts/OpenSans-Regular.ttf", // Fonts folder in current directory
-        "/System/Library/Fonts/Supplemental/Arial.ttf" // macOS system font
-    };
-    
-    for (const auto& path : fontPaths) {
-        if (font.openFromFile(path)) {
-            std::cout << "Successfully loaded font from: " << path << std::endl;
-            fontLoaded = true;
-            break;
-        }
-    }
-    
-    if (!fontLoaded) {
-        std::cerr << "ERROR: Failed to load any font!" << std::endl;
-        return false;
-    }
+bool UIManager::initialize(const sf::Font& loadedFont) {
+    font = &loadedFont;
+    fontLoaded = true;
     
     // Reinitialize text objects with the loaded font
-    resourceTitle.setFont(font);
+    resourceTitle.setFont(*font);
     resourceTitle.setString("Resources");
     resourceTitle.setCharacterSize(18);
     resourceTitle.setFillColor(sf::Color::White);
     
-    foodText.setFont(font);
+    foodText.setFont(*font);
     foodText.setCharacterSize(14);
     foodText.setFillColor(sf::Color(200, 230, 150));
     
-    woodText.setFont(font);
+    woodText.setFont(*font);
     woodText.setCharacterSize(14);
     woodText.setFillColor(sf::Color(160, 120, 80));
     
-    stoneText.setFont(font);
+    stoneText.setFont(*font);
     stoneText.setCharacterSize(14);
     stoneText.setFillColor(sf::Color(180, 180, 180));
     
-    goldText.setFont(font);
+    goldText.setFont(*font);
     goldText.setCharacterSize(14);
     goldText.setFillColor(sf::Color(255, 215, 0));
     
     // Unit info texts
-    unitTitle.setFont(font);
+    unitTitle.setFont(*font);
     unitTitle.setString("Selected Unit");
     unitTitle.setCharacterSize(18);
     unitTitle.setFillColor(sf::Color::White);
     
-    unitTypeText.setFont(font);
+    unitTypeText.setFont(*font);
     unitTypeText.setCharacterSize(14);
     unitTypeText.setFillColor(sf::Color::White);
     
-    unitHealthText.setFont(font);
+    unitHealthText.setFont(*font);
     unitHealthText.setCharacterSize(14);
     unitHealthText.setFillColor(sf::Color::White);
     
-    unitMovementText.setFont(font);
+    unitMovementText.setFont(*font);
     unitMovementText.setCharacterSize(14);
     unitMovementText.setFillColor(sf::Color::White);
     
-    unitActionText.setFont(font);
+    unitActionText.setFont(*font);
     unitActionText.setCharacterSize(14);
     unitActionText.setFillColor(sf::Color::White);
     
     // City info texts
-    cityTitle.setFont(font);
+    cityTitle.setFont(*font);
     cityTitle.setCharacterSize(22);
     cityTitle.setFillColor(sf::Color::White);
     
-    cityPopulation.setFont(font);
+    cityPopulation.setFont(*font);
     cityPopulation.setCharacterSize(16);
     cityPopulation.setFillColor(sf::Color::White);
     
-    cityFood.setFont(font);
+    cityFood.setFont(*font);
     cityFood.setCharacterSize(16);
     cityFood.setFillColor(sf::Color(200, 230, 150));
     
-    cityProduction.setFont(font);
+    cityProduction.setFont(*font);
     cityProduction.setCharacterSize(16);
     cityProduction.setFillColor(sf::Color(150, 180, 230));
     
-    cityGold.setFont(font);
+    cityGold.setFont(*font);
     cityGold.setCharacterSize(16);
     cityGold.setFillColor(sf::Color(255, 215, 0));
     
     // Production buttons text
-    settlerText.setFont(font);
+    settlerText.setFont(*font);
     settlerText.setString("Settler");
     settlerText.setCharacterSize(16);
     settlerText.setFillColor(sf::Color::White);
     
-    warriorText.setFont(font);
+    warriorText.setFont(*font);
     warriorText.setString("Warrior");
     warriorText.setCharacterSize(16);
     warriorText.setFillColor(sf::Color::White);
     
-    builderText.setFont(font);
+    builderText.setFont(*font);
     builderText.setString("Builder");
     builderText.setCharacterSize(16);
     builderText.setFillColor(sf::Color::White);
     
-    buildingText.setFont(font);
+    buildingText.setFont(*font);
     buildingText.setString("Granary");
     buildingText.setCharacterSize(16);
     buildingText.setFillColor(sf::Color::White);
     
     // Hero panel texts
-    heroTitle.setFont(font);
+    heroTitle.setFont(*font);
     heroTitle.setCharacterSize(24);
     heroTitle.setFillColor(sf::Color::White);
     
-    heroLevel.setFont(font);
+    heroLevel.setFont(*font);
     heroLevel.setCharacterSize(18);
     heroLevel.setFillColor(sf::Color::White);
     
-    heroExp.setFont(font);
+    heroExp.setFont(*font);
     heroExp.setCharacterSize(16);
     heroExp.setFillColor(sf::Color(150, 220, 255));
     
-    heroGold.setFont(font);
+    heroGold.setFont(*font);
     heroGold.setCharacterSize(16);
     heroGold.setFillColor(sf::Color(255, 215, 0));
     
-    heroAttributes.setFont(font);
+    heroAttributes.setFont(*font);
     heroAttributes.setCharacterSize(16);
     heroAttributes.setFillColor(sf::Color::White);
     
     // Inventory panel
-    inventoryTitle.setFont(font);
+    inventoryTitle.setFont(*font);
     inventoryTitle.setString("Inventory");
     inventoryTitle.setCharacterSize(18);
     inventoryTitle.setFillColor(sf::Color::White);
     
     // Skill panel
-    skillTitle.setFont(font);
+    skillTitle.setFont(*font);
     skillTitle.setString("Skills");
     skillTitle.setCharacterSize(18);
     skillTitle.setFillColor(sf::Color::White);
     
     // Army panel
-    armyTitle.setFont(font);
+    armyTitle.setFont(*font);
     armyTitle.setCharacterSize(24);
     armyTitle.setFillColor(sf::Color::White);
     
-    armyCounts.setFont(font);
+    armyCounts.setFont(*font);
     armyCounts.setCharacterSize(16);
     armyCounts.setFillColor(sf::Color::White);
     
     // Merchant panel
-    merchantTitle.setFont(font);
+    merchantTitle.setFont(*font);
     merchantTitle.setCharacterSize(24);
     merchantTitle.setFillColor(sf::Color::White);
     
-    merchantDescription.setFont(font);
+    merchantDescription.setFont(*font);
     merchantDescription.setCharacterSize(16);
     merchantDescription.setFillColor(sf::Color::White);
     
     // Shop panels
-    shopItemsTitle.setFont(font);
+    shopItemsTitle.setFont(*font);
     shopItemsTitle.setString("Items for Sale");
     shopItemsTitle.setCharacterSize(18);
     shopItemsTitle.setFillColor(sf::Color::White);
     
-    shopUnitsTitle.setFont(font);
+    shopUnitsTitle.setFont(*font);
     shopUnitsTitle.setString("Units for Sale");
     shopUnitsTitle.setCharacterSize(18);
     shopUnitsTitle.setFillColor(sf::Color::White);
     
     // Back button
-    backText.setFont(font);
+    backText.setFont(*font);
     backText.setString("Back");
     backText.setCharacterSize(16);
     backText.setFillColor(sf::Color::White);
     
     // Hero/Army toggle buttons
-    heroButtonText.setFont(font);
+    heroButtonText.setFont(*font);
     heroButtonText.setString("Unit Info");
     heroButtonText.setCharacterSize(16);
     heroButtonText.setFillColor(sf::Color::White);
     
-    armyButtonText.setFont(font);
+    armyButtonText.setFont(*font);
     armyButtonText.setString("Army");
     armyButtonText.setCharacterSize(16);
     armyButtonText.setFillColor(sf::Color::White);
     
     // Modal texts
-    modalTitle.setFont(font);
+    modalTitle.setFont(*font);
     modalTitle.setCharacterSize(18);
     modalTitle.setFillColor(sf::Color::White);
     
-    modalContent.setFont(font);
+    modalContent.setFont(*font);
     modalContent.setCharacterSize(14);
     modalContent.setFillColor(sf::Color::White);
     
-    closeButton.setFont(font);
+    closeButton.setFont(*font);
     closeButton.setString("Close");
     closeButton.setCharacterSize(14);
     closeButton.setFillColor(sf::Color::White);
     
     // Menu texts
-    titleText.setFont(font);
+    titleText.setFont(*font);
     titleText.setString("Hexagon Strategy Game");
     titleText.setCharacterSize(36);
     titleText.setFillColor(sf::Color::White);
     
-    startText.setFont(font);
-    startText.setString("Start Game");
+    startText.setFont(*font);
+    startText.setString(menuLoading ? "Loading..." : "Start Game");
     startText.setCharacterSize(24);
     startText.setFillColor(sf::Color::White);
     
     // Initialize inventory slots
-      const int maxInventorySlots = 12;
+    const int maxInventorySlots = Hero::INVENTORY_SLOTS;
     inventorySlots.resize(maxInventorySlots);
     // Instead of using resize for sf::Text, clear and fill it with constructed objects.
     inventoryTexts.clear();
     for (int i = 0; i < maxInventorySlots; ++i) {
-        inventoryTexts.push_back(sf::Text(font, "", 14));
+        inventoryTexts.push_back(sf::Text(*font, "", 14));
     }
     
     for (int i = 0; i < maxInventorySlots; i++) {
@@ -407,7 +390,7 @@ bool UIManager::initialize() {
         inventorySlots[i].setOutlineThickness(1.f);
         
         // Now inventoryTexts[i] is already constructed with the font.
-        inventoryTexts[i].setFont(font);
+        inventoryTexts[i].setFont(*font);
         inventoryTexts[i].setCharacterSize(14);
         inventoryTexts[i].setFillColor(sf::Color::White);
     }
@@ -417,7 +400,7 @@ bool UIManager::initialize() {
     skillSlots.resize(maxSkillSlots);
     skillTexts.clear();
     for (int i = 0; i < maxSkillSlots; ++i) {
-        skillTexts.push_back(sf::Text(font, "", 14));
+        skillTexts.push_back(sf::Text(*font, "", 14));
     }
     
     for (int i = 0; i < maxSkillSlots; i++) {
@@ -426,7 +409,7 @@ bool UIManager::initialize() {
         skillSlots[i].setOutlineColor(sf::Color(120, 120, 150));
         skillSlots[i].setOutlineThickness(1.f);
         
-        skillTexts[i].setFont(font);
+        skillTexts[i].setFont(*font);
         skillTexts[i].setCharacterSize(14);
         skillTexts[i].setFillColor(sf::Color::White);
     }
@@ -436,7 +419,7 @@ bool UIManager::initialize() {
     unitSlots.resize(maxUnitSlots);
     unitTexts.clear();
     for (int i = 0; i < maxUnitSlots; ++i) {
-        unitTexts.push_back(sf::Text(font, "", 14));
+        unitTexts.push_back(sf::Text(*font, "", 14));
     }
     
     for (int i = 0; i < maxUnitSlots; i++) {
@@ -445,7 +428,7 @@ bool UIManager::initialize() {
         unitSlots[i].setOutlineColor(sf::Color(120, 120, 150));
         unitSlots[i].setOutlineThickness(1.f);
         
-        unitTexts[i].setFont(font);
+        unitTexts[i].setFont(*font);
         unitTexts[i].setCharacterSize(14);
         unitTexts[i].setFillColor(sf::Color::White);
     }
@@ -455,7 +438,7 @@ bool UIManager::initialize() {
     shopItemSlots.resize(maxShopItemSlots);
     shopItemTexts.clear();
     for (int i = 0; i < maxShopItemSlots; ++i) {
-        shopItemTexts.push_back(sf::Text(font, "", 14));
+        shopItemTexts.push_back(sf::Text(*font, "", 14));
     }
     
     for (int i = 0; i < maxShopItemSlots; i++) {
@@ -464,7 +447,7 @@ bool UIManager::initialize() {
         shopItemSlots[i].setOutlineColor(sf::Color(120, 120, 150));
         shopItemSlots[i].setOutlineThickness(1.f);
         
-        shopItemTexts[i].setFont(font);
+        shopItemTexts[i].setFont(*font);
         shopItemTexts[i].setCharacterSize(14);
         shopItemTexts[i].setFillColor(sf::Color::White);
     }
@@ -474,7 +457,7 @@ bool UIManager::initialize() {
     shopUnitSlots.resize(maxShopUnitSlots);
     shopUnitTexts.clear();
     for (int i = 0; i < maxShopUnitSlots; ++i) {
-        shopUnitTexts.push_back(sf::Text(font, "", 14));
+        shopUnitTexts.push_back(sf::Text(*font, "", 14));
     }
     
     for (int i = 0; i < maxShopUnitSlots; i++) {
@@ -483,7 +466,7 @@ bool UIManager::initialize() {
         shopUnitSlots[i].setOutlineColor(sf::Color(120, 120, 150));
         shopUnitSlots[i].setOutlineThickness(1.f);
         
-        shopUnitTexts[i].setFont(font);
+        shopUnitTexts[i].setFont(*font);
         shopUnitTexts[i].setCharacterSize(14);
         shopUnitTexts[i].setFillColor(sf::Color::White);
     }
@@ -505,10 +488,10 @@ void UIManager::updateResourceDisplay() {
     goldText.setString("Gold: " + std::to_string(playerResources.gold));
 }
 
-void UIManager::updateUnitInfoDisplay(PlayerUnit* unit) {
+void UIManager::updateUnitInfoDisplay(const Unit* unit) {
     if (unit) {
         // Show panel with unit info
-        UnitType type = unit->getType();
+        UnitType type = unit->type;
         
         // Update text based on unit type
         switch(type) {
@@ -575,7 +558,7 @@ void UIManager::updateHeroDisplay(Hero* hero) {
     for (size_t i = 0; i < inventorySlots.size(); i++) {
         if (i < inventory.size()) {
             // Item exists at this slot
-            inventoryTexts[i].setString(inventory[i].name + (inventory[i].isEquipped ? " [E]" : ""));
+            inventoryTexts[i].setString(inventory[i].name.str() + (inventory[i].isEquipped ? " [E]" : ""));
             inventorySlots[i].setFillColor(sf::Color(60, 60, 100));
         } else {
             // Empty slot
@@ -589,7 +572,7 @@ void UIManager::updateHeroDisplay(Hero* hero) {
     for (size_t i = 0; i < skillSlots.size(); i++) {
         if (i < skills.size()) {
             // Skill exists at this slot
-            skillTexts[i].setString(skills[i].name + " (Lvl " + std::to_string(skills[i].level) + ")");
+            skillTexts[i].setString(skills[i].name.str() + " (Lvl " + std::to_string(skills[i].level) + ")");
             skillSlots[i].setFillColor(sf::Color(60, 100, 60));
         } else {
             // Empty slot
@@ -599,25 +582,24 @@ void UIManager::updateHeroDisplay(Hero* hero) {
     }
 }
 
-void UIManager::updateArmyDisplay(Army* army) {
+void UIManager::updateArmyDisplay(Army* army, const Hero* leader) {
     if (!army) return;
     
     // Update army panel title
-    Hero* leader = army->getLeader();
     armyTitle.setString(leader ? leader->getName() + "'s Army" : "Army");
     
     // Update army stats
     armyCounts.setString("Units: " + std::to_string(army->getSize()) + "/" + 
                         std::to_string(army->getCapacity()) + "\n" +
-                        "Total Attack: " + std::to_string(army->getTotalAttack()) + "\n" +
-                        "Total Defense: " + std::to_string(army->getTotalDefense()));
+                        "Total Attack: " + std::to_string(army->getTotalAttack(leader)) + "\n" +
+                        "Total Defense: " + std::to_string(army->getTotalDefense(leader)));
     
     // Update unit slots
     const auto& units = army->getUnits();
     for (size_t i = 0; i < unitSlots.size(); i++) {
         if (i < units.size()) {
             // Unit exists at this slot
-            std::string unitInfo = units[i].name + " (" + 
+            std::string unitInfo = units[i].name.str() + " (" + 
                                   std::to_string(units[i].health) + "/" + 
                                   std::to_string(units[i].maxHealth) + ")";
             unitTexts[i].setString(unitInfo);
@@ -659,7 +641,7 @@ void UIManager::updateMerchantDisplay(NPCMerchant* merchant) {
     for (size_t i = 0; i < shopItemSlots.size(); i++) {
         if (i < items.size()) {
             // Item exists at this slot
-            shopItemTexts[i].setString(items[i].name + " - " + 
+            shopItemTexts[i].setString(items[i].name.str() + " - " + 
                                      std::to_string(items[i].value) + " gold");
             shopItemSlots[i].setFillColor(sf::Color(60, 60, 100));
         } else {
@@ -674,7 +656,7 @@ void UIManager::updateMerchantDisplay(NPCMerchant* merchant) {
     for (size_t i = 0; i < shopUnitSlots.size(); i++) {
         if (i < units.size()) {
             // Unit exists at this slot
-            shopUnitTexts[i].setString(units[i].name + " - " + 
+            shopUnitTexts[i].setString(units[i].name.str() + " - " + 
                                      std::to_string(units[i].cost) + " gold");
             
             // Color based on unit type
@@ -716,14 +698,7 @@ void UIManager::showTileInfo(const game::Tile& tile, int col, int row) {
     closeButton.setPosition(sf::Vector2f(windowWidth / 2.f + 100.f, windowHeight / 2.f - 90.f));
     
     // Update modal text with tile info
-    std::string tileTypeName;
-    switch (tile.type) {
-        case game::TileType::Plains: tileTypeName = "Plains"; break;
-        case game::TileType::Hills: tileTypeName = "Hills"; break;
-        case game::TileType::Mountain: tileTypeName = "Mountain"; break;
-        case game::TileType::Forest: tileTypeName = "Forest"; break;
-        case game::TileType::Water: tileTypeName = "Water"; break;
-    }
+    std::string tileTypeName(Definitions::getTerrain(tile.type).name);
     modalTitle.setString("Tile Info: " + tileTypeName);
     
     std::string content = "Position: " + std::to_string(col) + ", " + std::to_string(row) + "\n";
@@ -791,11 +766,11 @@ void UIManager::showHeroInfo(Hero* hero) {
     backText.setPosition(sf::Vector2f(windowWidth / 2.f + 180.f, windowHeight / 2.f - 184.f));
 }
 
-void UIManager::showArmyInfo(Army* army) {
+void UIManager::showArmyInfo(Army* army, const Hero* leader) {
     if (!army) return;
     
     showArmyPanel = true;
-    updateArmyDisplay(army);
+    updateArmyDisplay(army, leader);
     
     // Position army panel in center of screen
     float windowWidth = uiView.getSize().x;
@@ -897,7 +872,14 @@ bool UIManager::isCloseButtonClicked(const sf::Vector2f& position) const {
 }
 
 bool UIManager::isStartButtonClicked(const sf::Vector2f& position) const {
-    return startButton.getGlobalBounds().contains(position);
+    return !menuLoading && startButton.getGlobalBounds().contains(position);
+}
+
+void UIManager::setMenuLoading(bool loading) {
+    if (loading == menuLoading) return;
+    menuLoading = loading;
+    startButton.setFillColor(loading ? sf::Color(70, 70, 90) : sf::Color(80, 80, 180));
+    startText.setString(loading ? "Loading..." : "Start Game");
 }
 
 bool UIManager::isSettlerButtonClicked(const sf::Vector2f& position) const {
@@ -978,7 +960,7 @@ bool UIManager::isShopUnitClicked(const sf::Vector2f& position, int& unitIndex)
     return false;
 }
 
-void UIManager::drawResourcePanel(sf::RenderWindow& window) {
+void UIManager::drawResourcePanel(DrawTarget& window) {
     // Position resource panel in top-left
     resourcePanel.setPosition(sf::Vector2f(10.f, 10.f));
     resourceTitle.setPosition(sf::Vector2f(20.f, 15.f));
@@ -995,7 +977,7 @@ void UIManager::drawResourcePanel(sf::RenderWindow& window) {
     window.draw(goldText);
 }
 
-void UIManager::drawUnitInfo(sf::RenderWindow& window, PlayerUnit* selectedUnit) {
+void UIManager::drawUnitInfo(DrawTarget& window, const Unit* selectedUnit) {
     if (selectedUnit) {
         float windowHeight = uiView.getSize().y;
         
@@ -1018,7 +1000,7 @@ void UIManager::drawUnitInfo(sf::RenderWindow& window, PlayerUnit* selectedUnit)
     }
 }
 
-void UIManager::drawCityInfo(sf::RenderWindow& window, game::GameCity* selectedCity) {
+void UIManager::drawCityInfo(DrawTarget& window, game::GameCity* selectedCity) {
     if (showCityPanel && selectedCity) {
         // Draw city panel
         window.draw(cityPanel);
@@ -1042,7 +1024,7 @@ void UIManager::drawCityInfo(sf::RenderWindow& window, game::GameCity* selectedC
     }
 }
 
-void UIManager::drawHeroInfo(sf::RenderWindow& window, Hero* hero) {
+void UIManager::drawHeroInfo(DrawTarget& window, Hero* hero) {
     if (showHeroPanel && hero) {
         // Draw hero panel
         window.draw(heroPanel);
@@ -1080,7 +1062,7 @@ void UIManager::drawHeroInfo(sf::RenderWindow& window, Hero* hero) {
     }
 }
 
-void UIManager::drawArmyInfo(sf::RenderWindow& window, Army* army) {
+void UIManager::drawArmyInfo(DrawTarget& window, Army* army) {
     if (showArmyPanel && army) {
         // Draw army panel
         window.draw(armyPanel);
@@ -1101,7 +1083,7 @@ void UIManager::drawArmyInfo(sf::RenderWindow& window, Army* army) {
     }
 }
 
-void UIManager::drawMerchantInfo(sf::RenderWindow& window, NPCMerchant* merchant) {
+void UIManager::drawMerchantInfo(DrawTarget& window, NPCMerchant* merchant) {
     if (showMerchantPanel && merchant) {
         // Draw merchant panel
         window.draw(merchantPanel);
@@ -1136,7 +1118,7 @@ void UIManager::drawMerchantInfo(sf::RenderWindow& window, NPCMerchant* merchant
     }
 }
 
-void UIManager::drawToggleButtons(sf::RenderWindow& window) {
+void UIManager::drawToggleButtons(DrawTarget& window) {
     float windowWidth = uiView.getSize().x;
     float windowHeight = uiView.getSize().y;
     
@@ -1155,7 +1137,7 @@ void UIManager::drawToggleButtons(sf::RenderWindow& window) {
     window.draw(armyButtonText);
 }
 
-void UIManager::drawModal(sf::RenderWindow& window) {
+void UIManager::drawModal(DrawTarget& window) {
     if (showModal) {
         window.draw(modalBackground);
         window.draw(modalTitle);
@@ -1164,7 +1146,7 @@ void UIManager::drawModal(sf::RenderWindow& window) {
     }
 }
 
-void UIManager::drawMenu(sf::RenderWindow& window) {
+void UIManager::drawMenu(DrawTarget& window) {
     float windowWidth = uiView.getSize().x;
     float windowHeight = uiView.getSize().y;
     
@@ -1175,7 +1157,11 @@ void UIManager::drawMenu(sf::RenderWindow& window) {
     startButton.setPosition(sf::Vector2f(windowWidth / 2.f - 100.f, windowHeight / 2.f - 25.f));
     startText.setPosition(sf::Vector2f(windowWidth / 2.f - 60.f, windowHeight / 2.f - 20.f));
     
-    window.draw(titleText);
     window.draw(startButton);
-    window.draw(startText);
+    
+    // Text waits for the font to arrive from the loader
+    if (fontLoaded) {
+        window.draw(titleText);
+        window.draw(startText);
+    }
 }
\ No newline at end of file
@@ -2,7 +2,8 @@
 #define UI_MANAGER_HPP
 
 #include "GameEntities.hpp"
-#include "PlayerUnit.hpp"
+#include "Components.hpp"
+#include "DrawTarget.hpp"
 #include "Hero.hpp"
 #include "Army.hpp"
 #include "NPCMerchant.hpp"
@@ -25,9 +26,11 @@ struct PlayerResources {
 // UI Manager class to handle all user interface elements
 class UIManager {
 private:
-    // Font for all text elements
-    sf::Font font;
+    // Font for all text elements; a blank stand-in until initialize()
+    sf::Font placeholderFont;
+    const sf::Font* font;
     bool fontLoaded;
+    bool menuLoading;
     
     // Views
     sf::View gameView;
@@ -153,14 +156,15 @@ public:
     ~UIManager();
     
     // Initialization
-    bool initialize();
+    // Point every text at the loaded font
+    bool initialize(const sf::Font& loadedFont);
     
     // Helper methods made public for error fix
     void updateResourceDisplay();
-    void updateUnitInfoDisplay(PlayerUnit* unit);
+    void updateUnitInfoDisplay(const Unit* unit);
     void updateCityDisplay(game::GameCity* city);
     void updateHeroDisplay(Hero* hero);
-    void updateArmyDisplay(Army* army);
+    void updateArmyDisplay(Army* army, const Hero* leader);
     void updateMerchantDisplay(NPCMerchant* merchant);
     
     // View management
@@ -194,7 +198,7 @@ public:
     bool isSkillSlotClicked(const sf::Vector2f& position, int& slotIndex) const;
     
     // Army panel management
-    void showArmyInfo(Army* army);
+    void showArmyInfo(Army* army, const Hero* leader);
     void hideArmyPanel() { showArmyPanel = false; }
     bool isArmyPanelVisible() const { return showArmyPanel; }
     bool isUnitSlotClicked(const sf::Vector2f& position, int& slotIndex) const;
@@ -215,21 +219,23 @@ public:
     
     // Menu management
     bool isStartButtonClicked(const sf::Vector2f& position) const;
+    // While loading, the start button is greyed out and ignores clicks
+    void setMenuLoading(bool loading);
     
     // Rendering methods
-    void drawResourcePanel(sf::RenderWindow& window);
-    void drawUnitInfo(sf::RenderWindow& window, PlayerUnit* selectedUnit);
-    void drawCityInfo(sf::RenderWindow& window, game::GameCity* selectedCity);
-    void drawHeroInfo(sf::RenderWindow& window, Hero* hero);
-    void drawArmyInfo(sf::RenderWindow& window, Army* army);
-    void drawMerchantInfo(sf::RenderWindow& window, NPCMerchant* merchant);
-    void drawToggleButtons(sf::RenderWindow& window);
-    void drawModal(sf::RenderWindow& window);
-    void drawMenu(sf::RenderWindow& window);
-    void drawNotifications(sf::RenderWindow& window);
+    void drawResourcePanel(DrawTarget& window);
+    void drawUnitInfo(DrawTarget& window, const Unit* selectedUnit);
+    void drawCityInfo(DrawTarget& window, game::GameCity* selectedCity);
+    void drawHeroInfo(DrawTarget& window, Hero* hero);
+    void drawArmyInfo(DrawTarget& window, Army* army);
+    void drawMerchantInfo(DrawTarget& window, NPCMerchant* merchant);
+    void drawToggleButtons(DrawTarget& window);
+    void drawModal(DrawTarget& window);
+    void drawMenu(DrawTarget& window);
+    void drawNotifications(DrawTarget& window);
     
     // Get font for other UI elements
-    const sf::Font& getFont() const { return font; }
+    const sf::Font& getFont() const { return *font; }
     
     // Notification system
     void showNotification(const std::string& message, float duration = 3.0f);
@@ -1,16 +1,32 @@
 #include "UnitManager.hpp"
+#include "Definitions.hpp"
+#include "Log.hpp"
+#include "Systems.hpp"
 #include <cmath>
-#include <iostream>
 #include <limits>
 #include <queue>
 #include <unordered_map>
 
-UnitManager::UnitManager() : selectedUnit(nullptr) {
+UnitManager::UnitManager(World& gameWorld) : world(gameWorld) {
     // Empty constructor
 }
 
-void UnitManager::addUnit(const sf::Vector2f& position, UnitType type) {
-    units.push_back(PlayerUnit(position, type));
+Entity UnitManager::addUnit(const sf::Vector2f& position, UnitType type) {
+    Entity unit = world.create();
+    world.setPosition(unit, position);
+    world.movements.add(unit);
+    world.units.add(unit, type);
+    world.addSelectable(unit, 15.0f, true);  // Same box as the drawn unit circle
+    return unit;
+}
+
+void UnitManager::spawnUnits(const std::vector<UnitSpawnedEvent>& spawned) {
+    for (const auto& event : spawned) {
+        Entity unit = addUnit(event.position, event.type);
+        if (event.faction != Faction::PLAYER) {
+            world.factions.add(unit, event.faction);
+        }
+    }
 }
 
 bool UnitManager::trySelectUnitAt(const sf::Vector2f& position) {
@@ -18,28 +34,43 @@ bool UnitManager::trySelectUnitAt(const sf::Vector2f& position) {
     deselectUnit();
     
     // Try to select a unit at the clicked position
-    for (auto& unit : units) {
-        if (unit.contains(position)) {
-            std::cout << "Unit selected!" << std::endl;
-            selectedUnit = &unit;
-            selectedUnit->setSelected(true);
-            return true;
-        }
+    Entity unit = world.pickAt(world.units, position);
+    if (unit.isValid()) {
+        LOG_DEBUG("unit", "Unit selected");
+        selectedUnit = unit;
+        world.selectables.get(unit)->selected = true;
+        return true;
     }
     return false;
 }
 
-void UnitManager::tryMoveSelectedUnit(const sf::Vector2f& target, const std::vector<std::vector<game::Tile>>& tileMap) {
-    if (!selectedUnit) {
-        std::cout << "No unit selected!" << std::endl;
+void UnitManager::tryMoveSelectedUnit(const sf::Vector2f& target, const std::vector<std::vector<game::Tile>>& tileMap,
+                                      std::pmr::memory_resource* scratch) {
+    if (!world.units.has(selectedUnit)) {
+        LOG_DEBUG("unit", "No unit selected");
         return;
     }
     
     // Clear the current path
     currentPath.clear();
     
+    if (moveUnitTo(selectedUnit, target, tileMap, scratch)) {
+        // Store the path for visualization
+        if (const MovementPath* path = world.paths.get(selectedUnit)) {
+            world.pathPool.copyWaypoints(*path, 0, currentPath);
+        }
+    }
+}
+
+bool UnitManager::moveUnitTo(Entity unit, const sf::Vector2f& target, const std::vector<std::vector<game::Tile>>& tileMap,
+                             std::pmr::memory_resource* scratch) {
+    const sf::Vector2f* position = getUnitPosition(unit);
+    if (!position) {
+        return false;
+    }
+    
     // Convert start and target positions to tile grid coordinates
-    sf::Vector2i startTilePos = worldPosToTilePos(selectedUnit->getPosition(), tileMap);
+    sf::Vector2i startTilePos = worldPosToTilePos(*position, tileMap);
     sf::Vector2i targetTilePos = worldPosToTilePos(target, tileMap);
     
     // Check if target tile is valid for movement
@@ -47,10 +78,10 @@ void UnitManager::tryMoveSelectedUnit(const sf::Vector2f& target, const std::vec
         targetTilePos.y >= 0 && targetTilePos.y < tileMap[0].size()) {
         
         // Check if target tile is walkable
-        game::TileType targetType = tileMap[targetTilePos.x][targetTilePos.y].type;
-        if (targetType == game::TileType::Water || targetType == game::TileType::Mountain) {
-            std::cout << "Cannot move to water or mountain tiles!" << std::endl;
-            return;
+        const Definitions::TerrainDefinition& target = Definitions::getTerrain(tileMap[targetTilePos.x][targetTilePos.y].type);
+        if (!target.walkable) {
+            LOG_INFO("unit", "Cannot move to {} tiles", target.name);
+            return false;
         }
         
         // Use the PathFinder to find a path - now directly returns world coordinates
@@ -59,65 +90,44 @@ void UnitManager::tryMoveSelectedUnit(const sf::Vector2f& target, const std::vec
             tileMap, 
             startTilePos, 
             targetTilePos, 
-            maxMovementPoints
+            maxMovementPoints,
+            scratch
         );
         
         if (worldPath.empty()) {
-            std::cout << "No valid path found!" << std::endl;
-            return;
+            LOG_INFO("unit", "No valid path found");
+            return false;
         }
         
-        // Store the path for visualization
-        currentPath = worldPath;
-        
         // Set the path for the unit to follow
-        selectedUnit->setPath(worldPath);
+        Systems::setPath(world, unit, worldPath);
         
-        std::cout << "Moving unit along path with " << worldPath.size() << " waypoints" << std::endl;
-    } else {
-        std::cout << "Target position is outside the map boundaries!" << std::endl;
-    }
-}
-
-void UnitManager::update(float deltaTime) {
-    for (auto& unit : units) {
-        unit.update(deltaTime);
-    }
-}
-
-void UnitManager::draw(sf::RenderWindow& window) {
-    // Each unit now draws its own path in its draw method
-    // Draw all units
-    for (auto& unit : units) {
-        unit.draw(window);
+        LOG_DEBUG("unit", "Moving unit along path with {} waypoints", worldPath.size());
+        return true;
     }
+    
+    LOG_INFO("unit", "Target position is outside the map boundaries");
+    return false;
 }
 
 void UnitManager::deselectUnit() {
-    if (selectedUnit) {
-        selectedUnit->setSelected(false);
-        selectedUnit = nullptr;
-        currentPath.clear(); // Clear the path when deselecting
+    if (Selectable* selectable = world.selectables.get(selectedUnit)) {
+        selectable->selected = false;
     }
-}
-
-PlayerUnit* UnitManager::getSelectedUnit() {
-    return selectedUnit;
+    selectedUnit = Entity{};
+    currentPath.clear(); // Clear the path when deselecting
 }
 
 void UnitManager::removeSelectedUnit() {
-    if (!selectedUnit) return;
+    if (!world.units.has(selectedUnit)) return;
     
-    // Find the unit in the vector
-    for (auto it = units.begin(); it != units.end(); ++it) {
-        if (&(*it) == selectedUnit) {
-            // Remove it
-            units.erase(it);
-            selectedUnit = nullptr;
-            currentPath.clear(); // Clear the path
-            return;
-        }
-    }
+    world.destroy(selectedUnit);
+    selectedUnit = Entity{};
+    currentPath.clear(); // Clear the path
+}
+
+const sf::Vector2f* UnitManager::getUnitPosition(Entity unit) const {
+    return world.units.has(unit) ? world.getPosition(unit) : nullptr;
 }
 
 sf::Vector2i UnitManager::worldPosToTilePos(const sf::Vector2f& worldPos, const std::vector<std::vector<game::Tile>>& tileMap) {
@@ -2,40 +2,58 @@
 #define UNIT_MANAGER_HPP
 
 #include "GameEntities.hpp"
-#include "PlayerUnit.hpp"
+#include "World.hpp"
 #include "PathFinder.hpp"
-#include <SFML/Graphics.hpp>
+#include "TurnEvents.hpp"
+#include <SFML/System/Vector2.hpp>
 #include <vector>
 
+// Facade over the unit entities in the World: spawning, selection and orders.
+// Movement itself is done by Systems::updateMovement.
 class UnitManager {
 private:
-    std::vector<PlayerUnit> units;
-    PlayerUnit* selectedUnit;
+    World& world;
+    Entity selectedUnit;
     
     // Store current path for visualization
     std::vector<sf::Vector2f> currentPath;
     
+public:
+    explicit UnitManager(World& world);
+    
     // Helper function to convert screen/world position to tile grid position
     sf::Vector2i worldPosToTilePos(const sf::Vector2f& worldPos, const std::vector<std::vector<game::Tile>>& tileMap);
     
     // Helper function to convert tile grid position to world position
     sf::Vector2f tilePosToWorldPos(const sf::Vector2i& tilePos, const std::vector<std::vector<game::Tile>>& tileMap);
     
-public:
-    UnitManager();
+    Entity addUnit(const sf::Vector2f& position, UnitType type);
     
-    void addUnit(const sf::Vector2f& position, UnitType type);
+    // Place the units cities trained this turn, in event order
+    void spawnUnits(const std::vector<UnitSpawnedEvent>& spawned);
     
     bool trySelectUnitAt(const sf::Vector2f& position);
-    void tryMoveSelectedUnit(const sf::Vector2f& target, const std::vector<std::vector<game::Tile>>& tileMap);
+    void tryMoveSelectedUnit(const sf::Vector2f& target, const std::vector<std::vector<game::Tile>>& tileMap,
+                             std::pmr::memory_resource* scratch = std::pmr::get_default_resource());
     
-    void update(float deltaTime);
-    void draw(sf::RenderWindow& window);
+    // Path a unit to the target tile; shared by player orders and scripted moves.
+    // The path search allocates its working state from scratch.
+    bool moveUnitTo(Entity unit, const sf::Vector2f& target, const std::vector<std::vector<game::Tile>>& tileMap,
+                    std::pmr::memory_resource* scratch = std::pmr::get_default_resource());
     
     void deselectUnit();
-    PlayerUnit* getSelectedUnit();
+    Entity getSelectedUnit() const { return selectedUnit; }
     
     void removeSelectedUnit();
+    
+    // Unit queries; nullptr / false for entities that are not units
+    const Unit* getUnit(Entity unit) const { return world.units.get(unit); }
+    const sf::Vector2f* getUnitPosition(Entity unit) const;
+    bool isMoving(Entity unit) const { return world.paths.has(unit); }
+    
+    // All unit entities, in dense order
+    const std::vector<Entity>& getUnitEntities() const { return world.units.entities(); }
+    size_t getUnitCount() const { return world.units.size(); }
 };
 
-#endif // UNIT_MANAGER_HPP
\ No newline at end of file
+#endif // UNIT_MANAGER_HPP
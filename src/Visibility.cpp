@@ -0,0 +1,175 @@
+#include "Visibility.hpp"
+#include "HexGrid.hpp"
+#include "World.hpp"
+
+Visibility::Visibility(const std::vector<std::vector<Tile>>& map, float size)
+    : tileMap(map),
+      width(0),
+      height(0),
+      hexSize(size),
+      version(0),
+      recomputeCount(0)
+{
+}
+
+void Visibility::reset() {
+    width = static_cast<int>(tileMap.size());
+    height = width > 0 ? static_cast<int>(tileMap[0].size()) : 0;
+
+    noTiles.resize(static_cast<std::size_t>(width) * height);
+    factions.clear();
+    observers.clear();
+    ++version;
+}
+
+void Visibility::update(const World& world) {
+    std::uint64_t previousVersion = version;
+
+    // Observers that are gone stop seeing
+    for (std::size_t i = observers.size(); i-- > 0;) {
+        Entity entity = observers.entityAt(i);
+        if (world.units.has(entity) || world.heroes.has(entity) || world.cities.has(entity)) continue;
+
+        forget(observers.data()[i]);
+        observers.remove(entity);
+    }
+
+    // Pick up new observers and the ones that changed tile
+    for (Entity entity : world.units.entities()) {
+        trackObserver(world, entity, UNIT_SIGHT);
+    }
+    for (Entity entity : world.heroes.entities()) {
+        trackObserver(world, entity, HERO_SIGHT);
+    }
+    for (Entity entity : world.cities.entities()) {
+        trackObserver(world, entity, CITY_SIGHT);
+    }
+
+    for (auto& observer : observers.data()) {
+        if (!observer.dirty) continue;
+
+        forget(observer);
+        look(observer);
+        observer.dirty = false;
+        ++recomputeCount;
+    }
+
+    // forget/look only bump the version for bits that actually flipped
+    if (version != previousVersion) {
+        version = previousVersion + 1;
+    }
+}
+
+void Visibility::trackObserver(const World& world, Entity entity, int range) {
+    const sf::Vector2f* position = world.getPosition(entity);
+    if (!position) return;
+
+    sf::Vector2i tile = HexGrid::worldToTile(*position, hexSize, width, height);
+    std::uint8_t faction = world.getFaction(entity);
+    Observer* observer = observers.get(entity);
+    if (!observer) {
+        observer = &observers.add(entity);
+        observer->dirty = true;
+    } else if (observer->tile != tile || observer->range != range || observer->faction != faction) {
+        // Take the old view back from the faction that had it
+        forget(*observer);
+        observer->dirty = true;
+    }
+    observer->tile = tile;
+    observer->range = range;
+    observer->faction = faction;
+}
+
+Visibility::FactionPlanes& Visibility::planesFor(std::uint8_t faction) {
+    while (factions.size() <= faction) {
+        FactionPlanes planes;
+        planes.watchers.assign(noTiles.size(), 0);
+        planes.visible.resize(noTiles.size());
+        planes.revealed.resize(noTiles.size());
+        factions.push_back(std::move(planes));
+    }
+    return factions[faction];
+}
+
+const TileBitset& Visibility::getVisible(std::uint8_t faction) const {
+    return faction < factions.size() ? factions[faction].visible : noTiles;
+}
+
+const TileBitset& Visibility::getRevealed(std::uint8_t faction) const {
+    return faction < factions.size() ? factions[faction].revealed : noTiles;
+}
+
+void Visibility::unionVisible(std::uint32_t factionMask, TileBitset& out) const {
+    out.resize(noTiles.size());
+    for (std::size_t f = 0; f < factions.size() && f < 32; ++f) {
+        if (factionMask & (1u << f)) {
+            out |= factions[f].visible;
+        }
+    }
+}
+
+void Visibility::intersectVisible(std::uint32_t factionMask, TileBitset& out) const {
+    out.resize(noTiles.size());
+    out.setAll();
+    for (std::size_t f = 0; f < 32; ++f) {
+        if (factionMask & (1u << f)) {
+            out &= getVisible(static_cast<std::uint8_t>(f));
+        }
+    }
+}
+
+void Visibility::unionRevealed(std::uint32_t factionMask, TileBitset& out) const {
+    out.resize(noTiles.size());
+    for (std::size_t f = 0; f < factions.size() && f < 32; ++f) {
+        if (factionMask & (1u << f)) {
+            out |= factions[f].revealed;
+        }
+    }
+}
+
+bool Visibility::blocksSight(const sf::Vector2i& tile, bool highGround) const {
+    TileType type = tileMap[tile.x][tile.y].type;
+    return type == TileType::Mountain || (type == TileType::Hills && !highGround);
+}
+
+void Visibility::forget(Observer& observer) {
+    if (observer.seenTiles.empty()) return;
+
+    FactionPlanes& planes = planesFor(observer.faction);
+    for (int index : observer.seenTiles) {
+        if (--planes.watchers[index] == 0) {
+            planes.visible.reset(index);
+            ++version;
+        }
+    }
+    observer.seenTiles.clear();
+}
+
+void Visibility::look(Observer& observer) {
+    FactionPlanes& planes = planesFor(observer.faction);
+    TileType standingOn = tileMap[observer.tile.x][observer.tile.y].type;
+    bool highGround = standingOn == TileType::Hills || standingOn == TileType::Mountain;
+
+    HexGrid::forEachInRadius(observer.tile, observer.range, width, height, [&](const sf::Vector2i& target) {
+        // Anything between us and the target can block it; the target itself
+        // is always seen, so mountain faces show up
+        bool blocked = false;
+        HexGrid::forEachOnLine(observer.tile, target, [&](const sf::Vector2i& step) {
+            if (blocked || step == observer.tile || step == target) return;
+            if (step.x < 0 || step.x >= width || step.y < 0 || step.y >= height) return;
+            blocked = blocksSight(step, highGround);
+        });
+        if (blocked) return;
+
+        int index = tileIndex(target);
+        observer.seenTiles.push_back(index);
+        if (planes.watchers[index]++ == 0) {
+            planes.visible.set(index);
+            ++version;
+        }
+        if (!planes.revealed.test(index)) {
+            planes.revealed.set(index);
+            ++version;
+        }
+    });
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "Ecs.hpp"
+#include "GameEntities.hpp"
+#include "TileBitset.hpp"
+#include <SFML/System/Vector2.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class World;
+
+// Fog of war, per faction.
+// Heroes, units and cities see the tiles around them; mountains block the
+// line of sight, and so do hills unless the observer stands on high ground.
+// Every tile counts how many observers of each faction see it, so an observer
+// that moves only takes back its old field of view and adds its new one;
+// observers that stayed on their tile cost nothing.
+// What a faction sees and has explored are bit-planes over the map, one bit
+// per tile, so whole-map questions across factions are a few word operations.
+class Visibility {
+public:
+    static constexpr int UNIT_SIGHT = 2;
+    static constexpr int HERO_SIGHT = 3;
+    static constexpr int CITY_SIGHT = 3;
+
+private:
+    struct Observer {
+        sf::Vector2i tile;
+        int range = 0;
+        std::uint8_t faction = 0;
+        std::vector<int> seenTiles;  // Tile indices currently counted for this observer
+        bool dirty = true;
+    };
+
+    const std::vector<std::vector<Tile>>& tileMap;
+    int width;
+    int height;
+    float hexSize;
+
+    // One entry per faction seen so far, indexed by faction id
+    struct FactionPlanes {
+        std::vector<std::uint16_t> watchers;  // Per tile, observers that see it
+        TileBitset visible;
+        TileBitset revealed;
+    };
+
+    ComponentPool<Observer> observers;
+    std::vector<FactionPlanes> factions;
+    TileBitset noTiles;                   // Answer for factions with no observers
+    std::uint64_t version;
+    std::size_t recomputeCount;
+
+    int tileIndex(const sf::Vector2i& tile) const { return tile.x * height + tile.y; }
+
+    FactionPlanes& planesFor(std::uint8_t faction);
+    bool blocksSight(const sf::Vector2i& tile, bool highGround) const;
+    void forget(Observer& observer);
+    void look(Observer& observer);
+    void trackObserver(const World& world, Entity entity, int range);
+
+public:
+    Visibility(const std::vector<std::vector<Tile>>& tileMap, float hexSize);
+
+    // Size the bitsets to the map; everything starts unexplored
+    void reset();
+
+    // Recompute sight for observers that were added, removed or moved tile
+    void update(const World& world);
+
+    bool isVisible(std::uint8_t faction, int x, int y) const { return getVisible(faction).test(tileIndex(sf::Vector2i(x, y))); }
+    bool isRevealed(std::uint8_t faction, int x, int y) const { return getRevealed(faction).test(tileIndex(sf::Vector2i(x, y))); }
+
+    // A faction's planes; all clear for factions without observers
+    const TileBitset& getVisible(std::uint8_t faction) const;
+    const TileBitset& getRevealed(std::uint8_t faction) const;
+
+    // Factions seen so far; ids run from 0 to getFactionCount() - 1
+    std::size_t getFactionCount() const { return factions.size(); }
+
+    // Tiles seen by any, or by every, faction in factionMask (bit f = faction f).
+    // out is resized to the map.
+    void unionVisible(std::uint32_t factionMask, TileBitset& out) const;
+    void intersectVisible(std::uint32_t factionMask, TileBitset& out) const;
+    void unionRevealed(std::uint32_t factionMask, TileBitset& out) const;
+
+    // Changes whenever either bitset does
+    std::uint64_t getVersion() const { return version; }
+
+    // Observer field-of-view recomputations so far; for profiling
+    std::size_t getRecomputeCount() const { return recomputeCount; }
+};
@@ -0,0 +1,46 @@
+#include "World.hpp"
+#include <algorithm>
+#include <cmath>
+
+void World::destroy(Entity entity) {
+    if (!registry.isAlive(entity)) return;
+
+    positions.remove(entity);
+    movements.remove(entity);
+    removePath(entity);
+    selectables.remove(entity);
+    factions.remove(entity);
+    units.remove(entity);
+    heroes.remove(entity);
+    armies.remove(entity);
+    cities.remove(entity);
+    merchants.remove(entity);
+    spatialIndex.remove(entity);
+
+    registry.destroy(entity);
+}
+
+void World::removePath(Entity entity) {
+    if (MovementPath* path = paths.get(entity)) {
+        pathPool.release(*path);
+        paths.remove(entity);
+    }
+}
+
+const sf::Vector2f* World::getPosition(Entity entity) const {
+    const Position* position = positions.get(entity);
+    return position ? &position->current : nullptr;
+}
+
+void World::setPosition(Entity entity, const sf::Vector2f& position) {
+    positions.add(entity, position);
+    spatialIndex.update(entity, position);
+}
+
+void World::addSelectable(Entity entity, float radius, bool square) {
+    selectables.add(entity, radius, square);
+
+    // A box reaches furthest at its corners
+    float reach = square ? radius * std::sqrt(2.0f) : radius;
+    maxPickRadius = std::max(maxPickRadius, reach);
+}
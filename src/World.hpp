@@ -0,0 +1,172 @@
+#pragma once
+
+#include "Ecs.hpp"
+#include "Components.hpp"
+#include "Hero.hpp"
+#include "Army.hpp"
+#include "City.hpp"
+#include "NPCMerchant.hpp"
+#include "SpatialHash.hpp"
+#include "PathPool.hpp"
+#include <SFML/System/Vector2.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
+// Every entity in the game and all of their components.
+// Units, the hero, cities and merchants are entities; the managers are thin
+// facades over these pools, and systems iterate the dense arrays directly.
+class World {
+private:
+    EntityRegistry registry;
+
+    // Largest distance from an entity's position at which it can be clicked
+    float maxPickRadius = 0.0f;
+
+public:
+    // Shared components.
+    // Write positions through setPosition() or the movement systems so the
+    // spatial index stays in step.
+    ComponentPool<Position> positions;
+    ComponentPool<Movement> movements;
+    ComponentPool<MovementPath> paths;
+    ComponentPool<Selectable> selectables;
+    ComponentPool<Faction> factions;
+
+    // Faction of an entity, Faction::PLAYER when it has none
+    std::uint8_t getFaction(Entity entity) const {
+        const Faction* faction = factions.get(entity);
+        return faction ? faction->id : Faction::PLAYER;
+    }
+
+    // Per-kind components
+    ComponentPool<Unit> units;
+    ComponentPool<Hero> heroes;
+    ComponentPool<Army> armies;
+    ComponentPool<game::GameCity> cities;
+    ComponentPool<NPCMerchant> merchants;
+
+    // Every positioned entity, filed by grid cell
+    SpatialHash spatialIndex;
+
+    // Waypoints of every MovementPath; drop paths through removePath()
+    PathPool pathPool;
+
+    World() = default;
+    World(const World&) = delete;
+    World& operator=(const World&) = delete;
+
+    Entity create() { return registry.create(); }
+
+    // Remove the entity and all of its components
+    void destroy(Entity entity);
+
+    // Stop the entity moving and return its waypoints to the pool
+    void removePath(Entity entity);
+
+    bool isAlive(Entity entity) const { return registry.isAlive(entity); }
+    std::size_t getEntityCount() const { return registry.size(); }
+
+    // Position of an entity, or nullptr if it has none
+    const sf::Vector2f* getPosition(Entity entity) const;
+
+    // Place an entity without interpolating from its old position
+    void setPosition(Entity entity, const sf::Vector2f& position);
+
+    // Make an entity clickable within radius of its position
+    void addSelectable(Entity entity, float radius, bool square);
+
+    // Entity in 'pool' whose pick area contains the point, closest first
+    template <typename T>
+    Entity pickAt(const ComponentPool<T>& pool, const sf::Vector2f& point) const {
+        Entity best;
+        float bestDistance = std::numeric_limits<float>::max();
+        spatialIndex.forEachNear(point, maxPickRadius, [&](Entity entity) {
+            if (!pool.has(entity)) return;
+            const Position* position = positions.get(entity);
+            const Selectable* selectable = selectables.get(entity);
+            if (!position || !selectable || !selectable->contains(position->current, point)) return;
+
+            float distance = distanceSquared(position->current, point);
+            if (distance < bestDistance) {
+                bestDistance = distance;
+                best = entity;
+            }
+        });
+        return best;
+    }
+
+    // All entities in 'pool' strictly within radius of center
+    template <typename T>
+    void findInRadius(const ComponentPool<T>& pool, const sf::Vector2f& center, float radius,
+                      std::vector<Entity>& out) const {
+        out.clear();
+        const float radiusSquared = radius * radius;
+        spatialIndex.forEachNear(center, radius, [&](Entity entity) {
+            if (!pool.has(entity)) return;
+            const Position* position = positions.get(entity);
+            if (position && distanceSquared(position->current, center) < radiusSquared) {
+                out.push_back(entity);
+            }
+        });
+    }
+
+    // Up to k entities in 'pool' nearest to center and strictly within maxRadius,
+    // nearest first. Searches outwards ring by ring and stops as soon as no
+    // unvisited cell can hold anything closer.
+    template <typename T>
+    void findNearest(const ComponentPool<T>& pool, const sf::Vector2f& center, std::size_t k,
+                     std::vector<Entity>& out,
+                     float maxRadius = std::numeric_limits<float>::max()) const {
+        out.clear();
+        if (k == 0) return;
+
+        const float maxRadiusSquared = maxRadius * maxRadius;  // Infinite when unbounded
+        std::vector<std::pair<float, Entity>> candidates;
+        auto visit = [&](Entity entity) {
+            if (!pool.has(entity)) return;
+            const Position* position = positions.get(entity);
+            if (!position) return;
+            float distance = distanceSquared(position->current, center);
+            if (distance < maxRadiusSquared) {
+                candidates.emplace_back(distance, entity);
+            }
+        };
+        auto closer = [](const std::pair<float, Entity>& a, const std::pair<float, Entity>& b) {
+            return a.first < b.first || (a.first == b.first && a.second.index < b.second.index);
+        };
+
+        const sf::Vector2i centerCell = spatialIndex.cellOf(center);
+        for (int ring = 0; spatialIndex.forEachInRing(centerCell, ring, visit); ++ring) {
+            // Anything not visited yet is at least this far away
+            float reach = ring * spatialIndex.getCellSize();
+            if (reach >= maxRadius) break;
+            if (candidates.size() >= k) {
+                std::nth_element(candidates.begin(), candidates.begin() + (k - 1), candidates.end(), closer);
+                if (candidates[k - 1].first <= reach * reach) break;
+            }
+        }
+
+        std::sort(candidates.begin(), candidates.end(), closer);
+        for (std::size_t i = 0; i < candidates.size() && i < k; ++i) {
+            out.push_back(candidates[i].second);
+        }
+    }
+
+    // Nearest entity in 'pool' strictly within maxRadius, or an invalid entity
+    template <typename T>
+    Entity findNearest(const ComponentPool<T>& pool, const sf::Vector2f& center, float maxRadius) const {
+        std::vector<Entity> nearest;
+        findNearest(pool, center, 1, nearest, maxRadius);
+        return nearest.empty() ? Entity{} : nearest.front();
+    }
+
+    static float distanceSquared(const sf::Vector2f& a, const sf::Vector2f& b) {
+        float dx = a.x - b.x;
+        float dy = a.y - b.y;
+        return dx * dx + dy * dy;
+    }
+};
@@ -0,0 +1,296 @@
+#include "WorldRenderer.hpp"
+#include "RomanUI.hpp"
+#include "HexGrid.hpp"
+#include "FrameArena.hpp"
+
+namespace {
+    sf::Vector2f interpolate(const sf::Vector2f& from, const sf::Vector2f& to, float alpha) {
+        return from + (to - from) * alpha;
+    }
+
+    const float UNIT_RADIUS = 15.0f;
+    const float MERCHANT_RADIUS = 15.0f;
+    const float ARMY_RADIUS = 10.0f;
+
+    // Border colors, picked by the owning city
+    const sf::Color BORDER_COLORS[] = {
+        sf::Color(200, 40, 40), sf::Color(40, 90, 200), sf::Color(230, 180, 30),
+        sf::Color(130, 50, 160), sf::Color(30, 150, 90), sf::Color(230, 110, 30)
+    };
+}
+
+WorldRenderer::MerchantProxy::MerchantProxy(const sf::Font& font, const std::string& merchantName)
+    : label(font, merchantName, 14), name(merchantName) {
+    marker.setRadius(MERCHANT_RADIUS);
+    marker.setOrigin(sf::Vector2f(MERCHANT_RADIUS, MERCHANT_RADIUS));
+    marker.setFillColor(sf::Color(160, 82, 45));
+    marker.setOutlineThickness(2.0f);
+    marker.setOutlineColor(sf::Color::Yellow);
+
+    label.setFillColor(sf::Color::White);
+    label.setOutlineColor(sf::Color::Black);
+    label.setOutlineThickness(1.0f);
+
+    // Approximate centering based on character size and string length
+    float approxWidth = merchantName.size() * label.getCharacterSize() * 0.6f;
+    float approxHeight = label.getCharacterSize() * 1.2f;
+    label.setOrigin(sf::Vector2f(approxWidth / 2.f, approxHeight / 2.f));
+}
+
+WorldRenderer::WorldRenderer(float size)
+    : hexSize(size), font(nullptr), pathLines(sf::PrimitiveType::Lines),
+      borderRevealedCount(0), borderLines(sf::PrimitiveType::Lines),
+      profileTrack(nullptr), terrainScope(0), entityScope(0) {
+    armyMarker.setRadius(ARMY_RADIUS);
+    armyMarker.setOrigin(sf::Vector2f(ARMY_RADIUS, ARMY_RADIUS));
+    armyMarker.setOutlineThickness(1.0f);
+    armyMarker.setOutlineColor(sf::Color::Black);
+
+    waypointMarker.setFillColor(sf::Color(255, 255, 0, 200));
+
+    fogHex.setPointCount(6);
+    for (int i = 0; i < 6; ++i) {
+        fogHex.setPoint(i, HexGrid::corner(sf::Vector2f(0.f, 0.f), hexSize, i));
+    }
+    fogHex.setFillColor(sf::Color(0, 0, 0, 140));
+}
+
+void WorldRenderer::setProfiler(Profiler& profiler, Profiler::Track* track) {
+    profileTrack = track;
+    terrainScope = profiler.addScope("terrain draw");
+    entityScope = profiler.addScope("entity draw");
+}
+
+void WorldRenderer::setFont(const sf::Font& labelFont) {
+    font = &labelFont;
+}
+
+void WorldRenderer::setHeroTexture(AssetManager::TextureHandle texture) {
+    heroTexture = std::move(texture);
+}
+
+void WorldRenderer::setTileMap(const std::vector<std::vector<game::Tile>>& tileMap) {
+    tiles = tileMap;
+}
+
+void WorldRenderer::syncProxies(const RenderSnapshot& snapshot) {
+    // Units: one proxy per snapshot entry, restyled only on type/selection change
+    if (unitProxies.size() != snapshot.units.size()) {
+        unitProxies.resize(snapshot.units.size());
+    }
+    for (size_t i = 0; i < snapshot.units.size(); ++i) {
+        const UnitSnapshot& unit = snapshot.units[i];
+        UnitProxy& proxy = unitProxies[i];
+        if (!proxy.styled || proxy.type != unit.type || proxy.selected != unit.selected) {
+            styleUnit(proxy, unit.type, unit.selected);
+        }
+    }
+
+    // Merchants: labels are only rebuilt when the merchant list changes
+    if (!font) return;
+    bool merchantsChanged = merchantProxies.size() != snapshot.merchants.size();
+    for (size_t i = 0; !merchantsChanged && i < snapshot.merchants.size(); ++i) {
+        merchantsChanged = merchantProxies[i].name != snapshot.merchants[i].name;
+    }
+    if (merchantsChanged) {
+        merchantProxies.clear();
+        for (const auto& merchant : snapshot.merchants) {
+            merchantProxies.emplace_back(*font, merchant.name);
+        }
+    }
+    for (size_t i = 0; i < snapshot.merchants.size(); ++i) {
+        const sf::Vector2f& position = snapshot.merchants[i].position;
+        merchantProxies[i].marker.setPosition(position);
+        merchantProxies[i].label.setPosition(sf::Vector2f(position.x, position.y - 35.f));
+    }
+}
+
+void WorldRenderer::styleUnit(UnitProxy& proxy, UnitType type, bool selected) {
+    // Color-coded unit types
+    sf::Color unitColor;
+    switch (type) {
+        case UnitType::Settler:
+            unitColor = sf::Color(255, 255, 150);  // Light yellow
+            break;
+        case UnitType::Warrior:
+            unitColor = sf::Color(255, 100, 100);  // Light red
+            break;
+        case UnitType::Builder:
+            unitColor = sf::Color(150, 255, 150);  // Light green
+            break;
+        default:
+            unitColor = sf::Color::White;
+    }
+
+    proxy.shape.setRadius(UNIT_RADIUS);
+    proxy.shape.setOrigin(sf::Vector2f(UNIT_RADIUS, UNIT_RADIUS));
+    if (selected) {
+        unitColor.a = 255;  // Full opacity when selected
+        proxy.shape.setOutlineThickness(2.f);
+        proxy.shape.setOutlineColor(sf::Color::Yellow);
+    } else {
+        unitColor.a = 220;  // Slightly transparent when not selected
+        proxy.shape.setOutlineThickness(0.f);
+    }
+    proxy.shape.setFillColor(unitColor);
+
+    proxy.type = type;
+    proxy.selected = selected;
+    proxy.styled = true;
+}
+
+void WorldRenderer::draw(DrawTarget& window, const sf::View& view, const RenderSnapshot& snapshot, float alpha) {
+    syncProxies(snapshot);
+
+    ProfileScope terrainTimer(profileTrack, terrainScope);
+    window.setCategory(DrawCategory::Terrain);
+    drawTiles(window, view, snapshot);
+    window.setCategory(DrawCategory::Borders);
+    drawBorders(window, snapshot);
+    terrainTimer.stop();
+
+    ProfileScope entityTimer(profileTrack, entityScope);
+    window.setCategory(DrawCategory::Entities);
+
+    // Merchants, then the army, then the hero on top
+    for (const auto& merchant : merchantProxies) {
+        window.draw(merchant.marker);
+        window.draw(merchant.label);
+    }
+
+    if (snapshot.hero.exists) {
+        sf::Vector2f heroPosition = interpolate(snapshot.hero.previousPosition, snapshot.hero.position, alpha);
+        drawArmy(window, snapshot.hero, heroPosition);
+        if (heroTexture.isReady()) {
+            RomanUI::drawSpriteCharacter(window, heroPosition, heroTexture.get(), snapshot.hero.selected);
+        }
+    }
+
+    // Cities with Roman styling and proximity highlight
+    if (font) {
+        for (const auto& city : snapshot.cities) {
+            RomanUI::drawRomanCity2D5(window, city.position, city.name, *font, city.playerNear);
+        }
+    }
+
+    // Units, with the selected unit's remaining path underneath
+    for (size_t i = 0; i < snapshot.units.size(); ++i) {
+        const UnitSnapshot& unit = snapshot.units[i];
+        if (unit.selected && !unit.remainingPath.empty()) {
+            drawPath(window, unit.remainingPath);
+        }
+
+        sf::CircleShape& shape = unitProxies[i].shape;
+        shape.setPosition(interpolate(unit.previousPosition, unit.position, alpha));
+        window.draw(shape);
+    }
+}
+
+void WorldRenderer::collectTilesInView(const sf::View& view, std::pmr::vector<size_t>& indices) const {
+    indices.clear();
+
+    // Calculate visible area
+    sf::Vector2f viewCenter = view.getCenter();
+    sf::Vector2f viewSize = view.getSize();
+    float left = viewCenter.x - viewSize.x / 2.f - hexSize;
+    float right = viewCenter.x + viewSize.x / 2.f + hexSize;
+    float top = viewCenter.y - viewSize.y / 2.f - hexSize;
+    float bottom = viewCenter.y + viewSize.y / 2.f + hexSize;
+
+    if (tiles.empty()) return;
+    const int width = static_cast<int>(tiles.size());
+    const int height = static_cast<int>(tiles[0].size());
+
+    // Only the rows and columns under the view's corners, plus a hex of
+    // margin for the staggered rows, are tested
+    sf::Vector2i first = HexGrid::worldToTile(sf::Vector2f(left, top), hexSize, width, height);
+    sf::Vector2i last = HexGrid::worldToTile(sf::Vector2f(right, bottom), hexSize, width, height);
+    int qBegin = std::max(0, first.x - 1);
+    int qEnd = std::min(width - 1, last.x + 1);
+    int rBegin = std::max(0, first.y - 1);
+    int rEnd = std::min(height - 1, last.y + 1);
+
+    for (int q = qBegin; q <= qEnd; ++q) {
+        for (int r = rBegin; r <= rEnd; ++r) {
+            const sf::Vector2f& center = tiles[q][r].center;
+            if (center.x < left || center.x > right || center.y < top || center.y > bottom) continue;
+            indices.push_back(static_cast<size_t>(q) * height + r);
+        }
+    }
+}
+
+void WorldRenderer::drawTiles(DrawTarget& window, const sf::View& view, const RenderSnapshot& snapshot) {
+    // Without fog data yet, everything is shown
+    const size_t height = tiles.empty() ? 0 : tiles[0].size();
+    const bool fog = snapshot.revealedTiles.size() == tiles.size() * height && !snapshot.revealedTiles.empty();
+
+    // Draw only tiles in the visible area; unexplored tiles are skipped outright.
+    // The list only lives for this frame, so it comes from frame scratch.
+    FrameVector<size_t> tilesInView(window.getScratch());
+    collectTilesInView(view, tilesInView);
+    for (size_t index : tilesInView) {
+        if (fog && !snapshot.revealedTiles.test(index)) continue;
+
+        const game::Tile& tile = tiles[index / height][index % height];
+        RomanUI::drawRomanHexagon2D5(window, tile, hexSize);
+        if (fog && !snapshot.visibleTiles.test(index)) {
+            fogHex.setPosition(tile.center);
+            window.draw(fogHex);
+        }
+    }
+}
+
+void WorldRenderer::drawBorders(DrawTarget& window, const RenderSnapshot& snapshot) {
+    const std::shared_ptr<const BorderMesh>& mesh = snapshot.borders;
+    if (!mesh) return;
+
+    // Borders on unexplored tiles would give away the cities under the fog.
+    // Explored tiles never go back under it, so the count only changes
+    // when the set does.
+    const TileBitset& revealed = snapshot.revealedTiles;
+    const size_t revealedCount = revealed.count();
+    if (mesh != borderMesh || revealedCount != borderRevealedCount) {
+        borderMesh = mesh;
+        borderRevealedCount = revealedCount;
+        borderLines.clear();
+        const size_t colorCount = sizeof(BORDER_COLORS) / sizeof(BORDER_COLORS[0]);
+        for (const auto& edge : mesh->edges) {
+            // Without fog data yet, everything is shown
+            if (!revealed.empty() && (edge.tile >= revealed.size() || !revealed.test(edge.tile))) continue;
+            sf::Color color = BORDER_COLORS[edge.owner % colorCount];
+            borderLines.append(sf::Vertex{edge.from, color});
+            borderLines.append(sf::Vertex{edge.to, color});
+        }
+    }
+    window.draw(borderLines);
+}
+
+void WorldRenderer::drawPath(DrawTarget& window, const std::vector<sf::Vector2f>& path) {
+    // Each segment is stacked three times with rising opacity to make the path
+    // more visible; all of it goes out in a single draw call
+    pathLines.clear();
+    for (size_t i = 0; i + 1 < path.size(); ++i) {
+        for (int thickness = 1; thickness <= 3; ++thickness) {
+            sf::Color color(255, 255, 0, 80 * thickness);
+            pathLines.append(sf::Vertex{path[i], color});
+            pathLines.append(sf::Vertex{path[i + 1], color});
+        }
+    }
+    window.draw(pathLines);
+
+    // Waypoint markers, larger at the destination
+    for (size_t i = 0; i < path.size(); ++i) {
+        float radius = i == path.size() - 1 ? 6.0f : 4.0f;
+        waypointMarker.setRadius(radius);
+        waypointMarker.setOrigin(sf::Vector2f(radius, radius));
+        waypointMarker.setPosition(path[i]);
+        window.draw(waypointMarker);
+    }
+}
+
+void WorldRenderer::drawArmy(DrawTarget& window, const HeroSnapshot& hero, const sf::Vector2f& heroPosition) {
+    for (const auto& offset : hero.armyOffsets) {
+        armyMarker.setPosition(heroPosition + offset);
+        window.draw(armyMarker);
+    }
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "AssetManager.hpp"
+#include "DrawTarget.hpp"
+#include "GameEntities.hpp"
+#include "Profiler.hpp"
+#include "RenderSnapshot.hpp"
+#include <SFML/Graphics.hpp>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+// Draws the world from render snapshots on the render thread.
+// Keeps its own copy of the tile map; terrain does not change after generation.
+// All SFML drawing state (shapes, labels, textures) lives here as render
+// proxies; the simulation entities are plain data.
+class WorldRenderer {
+private:
+    // Render-side counterpart of a unit; restyled only when its look changes
+    struct UnitProxy {
+        sf::CircleShape shape;
+        UnitType type = UnitType::Settler;
+        bool selected = false;
+        bool styled = false;
+    };
+
+    // Marker and name label for a merchant
+    struct MerchantProxy {
+        sf::CircleShape marker;
+        sf::Text label;
+        std::string name;
+
+        MerchantProxy(const sf::Font& font, const std::string& merchantName);
+    };
+
+    float hexSize;
+    std::vector<std::vector<game::Tile>> tiles;
+
+    // Render proxies and resources
+    // Null until the font has loaded
+    const sf::Font* font;
+    AssetManager::TextureHandle heroTexture;
+    std::vector<UnitProxy> unitProxies;
+    std::vector<MerchantProxy> merchantProxies;
+    sf::CircleShape armyMarker;
+    sf::CircleShape waypointMarker;
+    sf::VertexArray pathLines;
+
+    // Territory borders on explored tiles; the vertices are rebuilt only
+    // when the mesh or the explored area changes
+    std::shared_ptr<const BorderMesh> borderMesh;
+    std::size_t borderRevealedCount;
+    sf::VertexArray borderLines;
+
+    // Darkens explored tiles nobody currently sees
+    sf::ConvexShape fogHex;
+
+    // Terrain and entity draw timings, when a profiler is attached
+    Profiler::Track* profileTrack;
+    Profiler::ScopeId terrainScope;
+    Profiler::ScopeId entityScope;
+
+    void syncProxies(const RenderSnapshot& snapshot);
+    void styleUnit(UnitProxy& proxy, UnitType type, bool selected);
+
+    void drawTiles(DrawTarget& window, const sf::View& view, const RenderSnapshot& snapshot);
+    void drawBorders(DrawTarget& window, const RenderSnapshot& snapshot);
+    void drawPath(DrawTarget& window, const std::vector<sf::Vector2f>& path);
+    void drawArmy(DrawTarget& window, const HeroSnapshot& hero, const sf::Vector2f& heroPosition);
+
+public:
+    explicit WorldRenderer(float hexSize);
+
+    // Font for world labels; labels are skipped until one is set
+    void setFont(const sf::Font& labelFont);
+
+    // Hero sprite; the hero is drawn without it until it has loaded
+    void setHeroTexture(AssetManager::TextureHandle texture);
+
+    // Time terrain and entity drawing on the render thread's track
+    void setProfiler(Profiler& profiler, Profiler::Track* track);
+
+    // Take the initial tile map before the simulation thread starts
+    void setTileMap(const std::vector<std::vector<game::Tile>>& tileMap);
+
+    // Indices (q * height + r) of the tiles whose hexagons can overlap the view
+    void collectTilesInView(const sf::View& view, std::pmr::vector<size_t>& indices) const;
+
+    // Draw terrain and all entities into the game view.
+    // alpha blends moving entities between their previous and current tick positions.
+    void draw(DrawTarget& window, const sf::View& view, const RenderSnapshot& snapshot, float alpha);
+};
@@ -1,19 +1,28 @@
 #include "GameEntities.hpp"
-#include "PlayerUnit.hpp"
+#include "Definitions.hpp"
 #include "UIManager.hpp"
 #include "CityManager.hpp"
 #include "UnitManager.hpp"
 #include "PathFinder.hpp"
 #include "GameManager.hpp"
 #include "RomanUI.hpp"    // Roman Empire themed UI system
+#include "Simulation.hpp"
+#include "WorldRenderer.hpp"
+#include "Profiler.hpp"
+#include "ProfilerOverlay.hpp"
+#include "FrameArena.hpp"
+#include "AssetManager.hpp"
+#include "Log.hpp"
 #include <SFML/Graphics.hpp>
 #include <vector>
 #include <cmath>
-#include <iostream>
 #include <cstdlib>
 #include <ctime>
 #include <optional> // Needed for std::optional in SFML 3.0
 #include <limits>  // For std::numeric_limits
+#include <mutex>
+#include <chrono>
+#include <future>
 
 // Use the game namespace if desired (be cautious with duplicate using declarations)
 using namespace game;
@@ -26,6 +35,7 @@ const int MAP_HEIGHT = 180;
 const float HEX_SIZE = 30.f;
 const float HEX_WIDTH = std::sqrt(3.f) * HEX_SIZE;
 const float HEX_HEIGHT = 2.0f * HEX_SIZE;
+const float SIM_TICK_RATE = 60.0f;  // Simulation ticks per second, independent of frame rate
 
 // Global modal system variables
 RomanUI::ModalType currentModal = RomanUI::ModalType::None;
@@ -66,10 +76,8 @@ bool isClickOnSprite(const sf::Vector2f& clickPos, const sf::Vector2f& spritePos
     // Calculate sprite bounds considering the 2.5D scaling
     float spriteSize = 32.0f * spriteScale; // Base sprite size * scale
     sf::FloatRect spriteBounds(
-        spritePos.x - spriteSize / 2.0f,
-        spritePos.y - spriteSize / 2.0f,
-        spriteSize,
-        spriteSize
+        sf::Vector2f(spritePos.x - spriteSize / 2.0f, spritePos.y - spriteSize / 2.0f),
+        sf::Vector2f(spriteSize, spriteSize)
     );
     
     return spriteBounds.contains(clickPos);
@@ -89,24 +97,55 @@ sf::ConvexShape createPointyHex(const sf::Vector2f& center) {
 }
 
 // Forward declaration for a function to draw a tile
-void drawHexagon(sf::RenderWindow& window, const Tile& tile) {
+void drawHexagon(DrawTarget& window, const Tile& tile) {
     // Use the Roman Empire 2.5D style hexagon rendering
     RomanUI::drawRomanHexagon2D5(window, tile, HEX_SIZE);
 }
 
-int main() {
-    std::srand(static_cast<unsigned>(std::time(nullptr)));
+int main(int argc, char* argv[]) {
+    // Startup is timed from here to the first presented frame
+    const auto startupBegin = std::chrono::steady_clock::now();
+    auto millisecondsSinceStartup = [startupBegin] {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startupBegin).count();
+    };
+
+    // Console output is written by the log's own thread, so clicks and
+    // game events never wait on stdout
+    Log::Options logOptions;
+#ifndef NDEBUG
+    logOptions.minimumLevel = Log::Level::Debug;
+#endif
+    Log::start(logOptions);
 
     // Create the main window using sf::VideoMode with a Vector2u.
     sf::RenderWindow window(sf::VideoMode(sf::Vector2u(WINDOW_WIDTH, WINDOW_HEIGHT)), "Hexagon Map Game");
     window.setFramerateLimit(60);
 
-    // Create the UI Manager
+    // Everything is drawn through this so each frame's draw calls can be counted
+    DrawTarget drawTarget(window);
+
+    // Scratch memory for the main thread, emptied at the top of every frame;
+    // drawing code reaches it through the draw target
+    FrameArena frameArena;
+    drawTarget.setScratch(frameArena);
+
+    // Every font and texture comes from this cache. Files load on a
+    // background thread while the menu is up; paths are relative to the
+    // executable, its parent directory or the working directory.
+    AssetManager assets(argc > 0 ? argv[0] : "");
+#ifndef NDEBUG
+    assets.setHotReload(true);
+#endif
+    const AssetManager::FontHandle uiFont = assets.loadFont({
+        "assets/arial.ttf",
+        "assets/fonts/OpenSans-Regular.ttf",
+        "arial.ttf",
+        "/System/Library/Fonts/Supplemental/Arial.ttf" // macOS system font
+    });
+
+    // Create the UI Manager; it is initialized once the font arrives
     UIManager uiManager(WINDOW_WIDTH, WINDOW_HEIGHT);
-    if (!uiManager.initialize()) {
-        std::cerr << "Failed to initialize UI Manager!" << std::endl;
-        return -1;
-    }
+    uiManager.setMenuLoading(true);
 
     // Create game and UI views with Roman UI layout
     sf::View& gameView = uiManager.getGameView();
@@ -119,71 +158,59 @@ int main() {
     
     window.setView(gameView);
 
-    // Create the tile map
-    std::vector<std::vector<Tile>> tileMap(MAP_WIDTH, std::vector<Tile>(MAP_HEIGHT));
-
-    // Initialize the UnitManager and CityManager
-    UnitManager unitManager;
-    CityManager cityManager;
-    
-    // Initialize the GameManager for hero, army, and merchants
-    GameManager gameManager;
-    
-    // Set up each tile's center and randomly assign a tile type.
-    // Using an odd-r layout for zig-zag tiling:
-    for (int r = 0; r < MAP_HEIGHT; ++r) {
-        for (int q = 0; q < MAP_WIDTH; ++q) {
-            // Compute pixel positions
-            float xPos = HEX_SIZE * std::sqrt(3.f) * (q + 0.5f * (r % 2));
-            float yPos = HEX_SIZE * 1.5f * r;
-            tileMap[q][r].center = sf::Vector2f(xPos, yPos);
-
-            // Assign tile type randomly (example)
-            int tileRand = std::rand() % 100;
-            if (tileRand < 60) {
-                tileMap[q][r].type = TileType::Plains;
-                tileMap[q][r].stats.movementCost = 1.0f;
-            } else if (tileRand < 75) {
-                tileMap[q][r].type = TileType::Forest;
-                tileMap[q][r].stats.movementCost = 1.5f;
-            } else if (tileRand < 85) {
-                tileMap[q][r].type = TileType::Hills;
-                tileMap[q][r].stats.movementCost = 2.0f;
-            } else if (tileRand < 95) {
-                tileMap[q][r].type = TileType::Water;
-                tileMap[q][r].stats.movementCost = 3.0f;
-            } else {
-                tileMap[q][r].type = TileType::Mountain;
-                tileMap[q][r].stats.movementCost = 4.0f;
-            }
-        }
+    // Content definitions; the built-in defaults stand if the file is missing
+    const std::string& definitionsPath = assets.resolve("assets/definitions.txt");
+    if (!definitionsPath.empty()) {
+        Definitions::load(definitionsPath);
     }
 
-    // Place units at specific tile positions
-    sf::Vector2f initialPos = tileMap[5][5].center;
-    
-    // Place basic units with the UnitManager
-    unitManager.addUnit(initialPos, UnitType::Settler);
-    unitManager.addUnit(tileMap[7][5].center, UnitType::Warrior);
-    
-    // Initialize the game manager and hero at the starting position
-    gameManager.initialize(initialPos, uiManager.getFont());
-
-    // Add pre-generated cities at strategic locations using the same coordinate system
-    cityManager.addCity(tileMap[10][10].center);
-    std::cout << "Added city 1 at position: " << tileMap[10][10].center.x << ", " << tileMap[10][10].center.y << std::endl;
-
-    cityManager.addCity(tileMap[15][8].center);
-    std::cout << "Added city 2 at position: " << tileMap[15][8].center.x << ", " << tileMap[15][8].center.y << std::endl;
-
-    cityManager.addCity(tileMap[20][15].center);
-    std::cout << "Added city 3 at position: " << tileMap[20][15].center.x << ", " << tileMap[20][15].center.y << std::endl;
-
-    cityManager.addCity(tileMap[12][20].center);
-    std::cout << "Added city 4 at position: " << tileMap[12][20].center.x << ", " << tileMap[12][20].center.y << std::endl;
-
-    // Print the total number of cities
-    std::cout << "Total cities: " << cityManager.getCityCount() << std::endl;
+    // The simulation owns the world and runs on its own thread
+    Simulation simulation(MAP_WIDTH, MAP_HEIGHT, HEX_SIZE, SIM_TICK_RATE);
+    simulation.setSeed(static_cast<unsigned>(std::time(nullptr)));
+
+    // The renderer keeps its own copy of the terrain, taken once the map is generated
+    WorldRenderer worldRenderer(HEX_SIZE);
+    worldRenderer.setHeroTexture(assets.loadTexture("assets/soldier.png"));
+
+    // Frame profiler; the render loop and the simulation record on their own tracks.
+    // F3 toggles the overlay, F4 starts and saves a Chrome trace capture.
+    Profiler profiler;
+    Profiler::Track* renderTrack = profiler.addTrack("render");
+    const Profiler::ScopeId frameScope = profiler.addScope("frame");
+    const Profiler::ScopeId eventScope = profiler.addScope("events");
+    const Profiler::ScopeId uiScope = profiler.addScope("ui draw");
+    const Profiler::ScopeId modalScope = profiler.addScope("modals");
+    const Profiler::ScopeId displayScope = profiler.addScope("display");
+    // Steady-state frames should not touch the heap; the overlay counts the ones that do
+    profiler.setAllocationBudget(frameScope, 0);
+    worldRenderer.setProfiler(profiler, renderTrack);
+    simulation.setProfiler(profiler);
+    // Needs the font, so it is built when the font arrives
+    std::optional<ProfilerOverlay> profilerOverlay;
+
+    // "Press E to enter" prompt; kept across frames so showing it does not
+    // allocate, and its text only changes when a different city is nearby
+    sf::RectangleShape cityPromptBackground(sf::Vector2f(300, 50));
+    cityPromptBackground.setFillColor(sf::Color(0, 0, 0, 180));
+    cityPromptBackground.setOutlineColor(RomanUI::Colors::ROMAN_GOLD);
+    cityPromptBackground.setOutlineThickness(2);
+    std::optional<sf::Text> cityPrompt;
+    std::string cityPromptName;
+
+    // The map is generated in the background while the menu is shown; the
+    // simulation thread starts once it is done
+    std::future<void> worldGeneration = std::async(std::launch::async, [&simulation] {
+        simulation.initialize();
+    });
+    bool uiReady = false;
+    bool worldReady = false;
+    bool firstFramePresented = false;
+
+    // World references for input handling; only use these while holding simulation.getMutex()
+    std::vector<std::vector<Tile>>& tileMap = simulation.getTileMap();
+    UnitManager& unitManager = simulation.getUnitManager();
+    CityManager& cityManager = simulation.getCityManager();
+    GameManager& gameManager = simulation.getGameManager();
 
     // Define game state.
     enum class GameState { 
@@ -203,40 +230,75 @@ int main() {
     // Variables for tile selection
     int selectedCol = -1, selectedRow = -1;
 
-    // Game timer for turns
-    sf::Clock gameClock;
-    const float TURN_LENGTH = 10.0f;  // 10 seconds per turn
-    float turnTimer = TURN_LENGTH;
+    // Latest snapshot published by the simulation thread
+    RenderSnapshot snapshot;
+
+    // Events that arrived while the simulation held the world lock
+    std::vector<sf::Event> pendingEvents;
 
     sf::Clock clock;
     // SFML 3.0: pollEvent returns a std::optional<sf::Event>
     while (window.isOpen()) {
+        frameArena.reset();
+
+        // Everything recorded up to the end of the last frame, on both threads
+        profiler.collect();
+        ProfileScope frameTimer(renderTrack, frameScope);
+
         float deltaTime = clock.restart().asSeconds();
 
-        // Update turn timer if in playing state
-       if (gameState == GameState::Playing) {
-            turnTimer -= deltaTime;
-            if (turnTimer <= 0.0f) {
-                // Process turn for cities
-                cityManager.update(deltaTime);
-                
-                // Reset timer
-                turnTimer = TURN_LENGTH;
+        // Finished loads and hot reloads go in place before anything draws
+        assets.update();
+
+        // Finish startup as the background work completes
+        if (!uiReady || !worldReady) {
+            if (!uiReady && uiFont.isDone()) {
+                if (!uiFont.isReady()) {
+                    LOG_ERROR("startup", "Failed to load any font");
+                    Log::stop();
+                    return -1;
+                }
+                LOG_INFO("startup", "Loaded font from {}", uiFont.getPath());
+                uiManager.initialize(uiFont.get());
+                worldRenderer.setFont(uiFont.get());
+                profilerOverlay.emplace(profiler, renderTrack, uiFont.get());
+                cityPrompt.emplace(uiFont.get());
+                cityPrompt->setCharacterSize(14);
+                cityPrompt->setFillColor(RomanUI::Colors::ROMAN_GOLD);
+                uiReady = true;
             }
+
+            if (!worldReady && worldGeneration.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+                worldGeneration.get();
+                worldRenderer.setTileMap(simulation.getTileMap());
+                simulation.start();
+                worldReady = true;
+                LOG_INFO("startup", "World ready after {} ms", millisecondsSinceStartup());
+            }
+
+            uiManager.setMenuLoading(!uiReady || !worldReady);
         }
-        
-        // Update game manager
-        gameManager.update(deltaTime);
+
+        ProfileScope eventTimer(renderTrack, eventScope);
 
         std::optional<sf::Event> eventOpt;
         while ((eventOpt = window.pollEvent())) {
-            sf::Event& event = *eventOpt;
-            
-            // SFML 3.0 event handling
-            if (auto closeEvent = event.getIf<sf::Event::Closed>()) {
+            if (eventOpt->is<sf::Event::Closed>()) {
                 window.close();
+            } else {
+                pendingEvents.push_back(*eventOpt);
             }
-            else if (auto mouseEvent = event.getIf<sf::Event::MouseButtonPressed>()) {
+        }
+
+        // Input handlers touch the world, so they need the world lock. If the
+        // simulation is busy with a long tick, keep the events for the next
+        // frame instead of stalling presentation.
+        std::unique_lock<std::mutex> worldLock(simulation.getMutex(), std::try_to_lock);
+        for (size_t eventIndex = 0; worldLock.owns_lock() && eventIndex < pendingEvents.size(); ++eventIndex) {
+            sf::Event& event = pendingEvents[eventIndex];
+            
+            // SFML 3.0 event handling
+            if (auto mouseEvent = event.getIf<sf::Event::MouseButtonPressed>()) {
                 sf::Vector2i pixelPos = sf::Mouse::getPosition(window);
                 
                 if (mouseEvent->button == sf::Mouse::Button::Left) {
@@ -264,14 +326,14 @@ int main() {
                             float closeButtonHeight = 30;
                             
                             // Debug output for modal click detection
-                            std::cout << "Modal click at UI position: " << uiPos.x << ", " << uiPos.y << std::endl;
-                            std::cout << "Close button area: " << closeButtonX << ", " << closeButtonY 
-                                     << " to " << (closeButtonX + closeButtonWidth) << ", " << (closeButtonY + closeButtonHeight) << std::endl;
+                            LOG_DEBUG("input", "Modal click at UI position {}, {}", uiPos.x, uiPos.y);
+                            LOG_DEBUG("input", "Close button area {}, {} to {}, {}", closeButtonX, closeButtonY,
+                                      closeButtonX + closeButtonWidth, closeButtonY + closeButtonHeight);
                             
                             if (uiPos.x >= closeButtonX && uiPos.x <= closeButtonX + closeButtonWidth &&
                                 uiPos.y >= closeButtonY && uiPos.y <= closeButtonY + closeButtonHeight) {
                                 // Close button clicked
-                                std::cout << "Close button clicked!" << std::endl;
+                                LOG_DEBUG("input", "Close button clicked");
                                 currentModal = RomanUI::ModalType::None;
                                 isModalOpen = false;
                                 continue;
@@ -280,7 +342,7 @@ int main() {
                             // Check if click is outside modal area to close it
                             if (uiPos.x < modalX || uiPos.x > modalX + RomanUI::Layout::MODAL_WIDTH ||
                                 uiPos.y < modalY || uiPos.y > modalY + RomanUI::Layout::MODAL_HEIGHT) {
-                                std::cout << "Clicked outside modal, closing." << std::endl;
+                                LOG_DEBUG("input", "Clicked outside modal, closing");
                                 currentModal = RomanUI::ModalType::None;
                                 isModalOpen = false;
                             }
@@ -319,7 +381,7 @@ int main() {
                         }
                         else if (uiManager.isArmyButtonClicked(uiPos)) {
                             if (gameManager.getPlayerArmy()) {
-                                uiManager.showArmyInfo(gameManager.getPlayerArmy());
+                                uiManager.showArmyInfo(gameManager.getPlayerArmy(), gameManager.getArmyLeader(gameManager.getPlayerArmy()));
                                 gameState = GameState::ArmyView;
                             }
                         }
@@ -336,8 +398,8 @@ int main() {
                             
                             // Debug output for clicking with view center for debugging
                             sf::Vector2f viewCenter = gameView.getCenter();
-                            std::cout << "Click at world position: " << worldPos.x << ", " << worldPos.y 
-                                     << " (view center: " << viewCenter.x << ", " << viewCenter.y << ")" << std::endl;
+                            LOG_DEBUG("input", "Click at world position {}, {} (view center {}, {})",
+                                      worldPos.x, worldPos.y, viewCenter.x, viewCenter.y);
                             
                             // Try to select the hero or a merchant
                             if (gameManager.trySelectEntityAt(worldPos)) {
@@ -351,7 +413,7 @@ int main() {
                                 // Try to select a city
                                 if (cityManager.selectCityAt(worldPos)) {
                                     game::GameCity* selectedCity = cityManager.getSelectedCity();
-                                    std::cout << "Selected city: " << selectedCity->getName() << std::endl;
+                                    LOG_INFO("input", "Selected city: {}", selectedCity->getName());
                                     uiManager.showCityInfo(selectedCity);
                                     gameState = GameState::CityView;
                                 } else {
@@ -461,10 +523,10 @@ int main() {
                     
                     // If hero is selected, move the hero (which moves the army with it)
                     if (gameManager.isHeroSelected()) {
-                        Hero* hero = gameManager.getPlayerHero();
-                        if (hero) {
+                        const sf::Vector2f* heroPos = gameManager.getHeroPosition();
+                        if (heroPos) {
                             // Find a path through walkable tiles and set it for the hero
-                            sf::Vector2i startTilePos = screenToTile(hero->getPosition());
+                            sf::Vector2i startTilePos = screenToTile(*heroPos);
                             sf::Vector2i targetTilePos = screenToTile(worldPos);
                             
                             if (targetTilePos.x >= 0 && targetTilePos.x < MAP_WIDTH &&
@@ -472,14 +534,14 @@ int main() {
                                 
                                 // Check if target tile is walkable
                                 TileType targetType = tileMap[targetTilePos.x][targetTilePos.y].type;
-                                if (targetType != TileType::Water && targetType != TileType::Mountain) {
+                                if (Definitions::getTerrain(targetType).walkable) {
                                     // Get a path to the target position
                                     std::vector<sf::Vector2f> path = PathFinder::findPath(
-                                        tileMap, startTilePos, targetTilePos, 100
+                                        tileMap, startTilePos, targetTilePos, 100, &frameArena
                                     );
                                     
                                     if (!path.empty()) {
-                                        hero->setPath(path);
+                                        gameManager.setHeroPath(path);
                                     }
                                 }
                             }
@@ -487,11 +549,25 @@ int main() {
                     }
                     // Otherwise try to move a regular unit
                     else {
-                        unitManager.tryMoveSelectedUnit(worldPos, tileMap);
+                        unitManager.tryMoveSelectedUnit(worldPos, tileMap, &frameArena);
                     }
                 }
             }
             else if (auto keyEvent = event.getIf<sf::Event::KeyPressed>()) {
+                if (keyEvent->code == sf::Keyboard::Key::F3) {
+                    if (profilerOverlay) profilerOverlay->toggle();
+                } else if (keyEvent->code == sf::Keyboard::Key::F4) {
+                    if (!profiler.isCapturing()) {
+                        profiler.startCapture();
+                        LOG_INFO("profiler", "Capture started");
+                    } else {
+                        profiler.stopCapture();
+                        if (profiler.writeChromeTrace("hexmap_trace.json")) {
+                            LOG_INFO("profiler", "Capture saved to hexmap_trace.json");
+                        }
+                    }
+                }
+
                 if (gameState == GameState::Playing || 
                     gameState == GameState::CityView ||
                     gameState == GameState::HeroView ||
@@ -552,20 +628,21 @@ int main() {
                     
                     if (keyEvent->code == sf::Keyboard::Key::M) {
                         if (gameState == GameState::Playing && gameManager.getPlayerArmy()) {
-                            uiManager.showArmyInfo(gameManager.getPlayerArmy());
+                            uiManager.showArmyInfo(gameManager.getPlayerArmy(), gameManager.getArmyLeader(gameManager.getPlayerArmy()));
                             gameState = GameState::ArmyView;
                         }
                     }
                     
                     // Handle founding a city with a Settler
                     if (keyEvent->code == sf::Keyboard::Key::F) {
-                        PlayerUnit* selectedUnit = unitManager.getSelectedUnit();
-                        if (selectedUnit && selectedUnit->getType() == UnitType::Settler) {
+                        Entity selectedUnit = unitManager.getSelectedUnit();
+                        const Unit* unit = unitManager.getUnit(selectedUnit);
+                        if (unit && unit->type == UnitType::Settler) {
                             // Create a new city at the settler's position
-                            sf::Vector2f pos = selectedUnit->getPosition();
+                            sf::Vector2f pos = *unitManager.getUnitPosition(selectedUnit);
                             cityManager.addCity(pos);
-                            std::cout << "New city founded at position: " << pos.x << ", " << pos.y << std::endl;
-                            std::cout << "Total cities: " << cityManager.getCityCount() << std::endl;
+                            LOG_INFO("city", "New city founded at {}, {}, {} cities in total", pos.x, pos.y,
+                                     cityManager.getCityCount());
                             
                             // Remove the settler unit (consume it)
                             unitManager.removeSelectedUnit();
@@ -574,7 +651,7 @@ int main() {
                     
                     // Debug - press C to print city info
                     if (keyEvent->code == sf::Keyboard::Key::C) {
-                        std::cout << "City count: " << cityManager.getCityCount() << std::endl;
+                        LOG_INFO("city", "City count: {}", cityManager.getCityCount());
                     }
                     
                     // Roman UI Modal shortcuts
@@ -596,26 +673,17 @@ int main() {
                     // City interaction - press E when near a city
                     if (keyEvent->code == sf::Keyboard::Key::E) {
                         // Check if player is near any city
-                        if (gameManager.getPlayerHero()) {
-                            sf::Vector2f heroPos = gameManager.getPlayerHero()->getPosition();
-                            auto& cities = cityManager.getCities();
-                            bool foundNearbyCity = false;
-                            for (const auto& city : cities) {
-                                sf::Vector2f cityPos = city.getPosition();
-                                float distance = std::sqrt(std::pow(heroPos.x - cityPos.x, 2) + 
-                                                          std::pow(heroPos.y - cityPos.y, 2));
-                                // Increased detection radius for easier interaction
-                                if (distance < HEX_SIZE * 3.5f) { // Within 3.5 hex radius instead of 2
-                                    currentModal = RomanUI::ModalType::CityManagement;
-                                    isModalOpen = true;
-                                    nearestCityPos = cityPos;
-                                    foundNearbyCity = true;
-                                    std::cout << "Entering city: " << city.getName() << " (distance: " << distance << ")" << std::endl;
-                                    break;
-                                }
-                            }
-                            if (!foundNearbyCity) {
-                                std::cout << "No city nearby. Move closer to a city and press E to enter." << std::endl;
+                        const sf::Vector2f* heroPos = gameManager.getHeroPosition();
+                        if (heroPos) {
+                            Entity cityEntity = simulation.findCityNear(*heroPos, simulation.getCityInteractionRadius());
+                            const GameCity* city = cityManager.getCity(cityEntity);
+                            if (city) {
+                                currentModal = RomanUI::ModalType::CityManagement;
+                                isModalOpen = true;
+                                nearestCityPos = *cityManager.getCityPosition(cityEntity);
+                                LOG_INFO("city", "Entering city: {}", city->getName());
+                            } else {
+                                LOG_INFO("city", "No city nearby; move closer to a city and press E to enter");
                             }
                         }
                     }
@@ -635,158 +703,129 @@ int main() {
             }
         }
 
-        if (gameState == GameState::Playing || 
-            gameState == GameState::CityView ||
-            gameState == GameState::HeroView ||
-            gameState == GameState::ArmyView ||
-            gameState == GameState::MerchantView) {
-            
-            unitManager.update(deltaTime);
+        bool inGame = gameState == GameState::Playing || 
+                      gameState == GameState::CityView ||
+                      gameState == GameState::HeroView ||
+                      gameState == GameState::ArmyView ||
+                      gameState == GameState::MerchantView;
+
+        if (worldLock.owns_lock()) {
+            pendingEvents.clear();
+            simulation.setActivity(inGame, gameState == GameState::Playing);
+            worldLock.unlock();
+        }
+        eventTimer.stop();
+
+        // Pick up the newest world state
+        simulation.getSnapshots().acquire(snapshot);
+
+        if (inGame) {
             gameView.move(viewVelocity * deltaTime);
             window.setView(gameView);
         }
 
         window.clear(sf::Color(30, 30, 30));
+        drawTarget.beginFrame();
+        drawTarget.setCategory(DrawCategory::UI);
         
         if (gameState == GameState::MainMenu) {
             window.setView(uiView);
-            uiManager.drawMenu(window);
+            uiManager.drawMenu(drawTarget);
         } else {
-            // Calculate visible area
-            sf::Vector2f viewCenter = gameView.getCenter();
-            sf::Vector2f viewSize = gameView.getSize();
-            float left = viewCenter.x - viewSize.x / 2.f - HEX_SIZE;
-            float right = viewCenter.x + viewSize.x / 2.f + HEX_SIZE;
-            float top = viewCenter.y - viewSize.y / 2.f - HEX_SIZE;
-            float bottom = viewCenter.y + viewSize.y / 2.f + HEX_SIZE;
-            
-            // Draw only tiles in the visible area
-            for (int x = 0; x < MAP_WIDTH; ++x) {
-                for (int y = 0; y < MAP_HEIGHT; ++y) {
-                    const sf::Vector2f& center = tileMap[x][y].center;
-                    
-                    // Only draw if in visible area
-                    if (center.x >= left && center.x <= right && 
-                        center.y >= top && center.y <= bottom) {
-                        RomanUI::drawRomanHexagon2D5(window, tileMap[x][y], HEX_SIZE);
-                    }
-                }
-            }
-            
-            // Draw game entities
-            gameManager.draw(window);
-            
-            // Draw cities with Roman styling and proximity detection
-            auto& cities = cityManager.getCities();
-            sf::Vector2f heroPos = gameManager.getPlayerHero() ? gameManager.getPlayerHero()->getPosition() : sf::Vector2f(0, 0);
-            
-            for (const auto& city : cities) {
-                sf::Vector2f cityPos = city.getPosition();
-                float distance = gameManager.getPlayerHero() ? 
-                    std::sqrt(std::pow(heroPos.x - cityPos.x, 2) + std::pow(heroPos.y - cityPos.y, 2)) : 
-                    std::numeric_limits<float>::max();
-                // Use same improved detection radius as keyboard interaction
-                bool isPlayerNear = distance < HEX_SIZE * 3.5f;
-                
-                RomanUI::drawRomanCity2D5(window, cityPos, city.getName(), uiManager.getFont(), isPlayerNear);
-            }
-            
-            // Draw units
-            unitManager.draw(window);
+            // Draw terrain, cities, units, hero and merchants from the snapshot
+            float alpha = snapshot.interpolationAlpha(std::chrono::steady_clock::now());
+            worldRenderer.draw(drawTarget, gameView, snapshot, alpha);
 
             // Draw UI elements
+            ProfileScope uiTimer(renderTrack, uiScope);
+            drawTarget.setCategory(DrawCategory::UI);
             window.setView(uiView);
             
             // Draw Roman-style sidebar with minimap and management buttons
             sf::Vector2f uiViewSize = uiView.getSize();
-            sf::Vector2f playerPos = gameManager.getPlayerHero() ? gameManager.getPlayerHero()->getPosition() : sf::Vector2f(0, 0);
+            sf::Vector2f playerPos = snapshot.hero.exists ? snapshot.hero.position : sf::Vector2f(0, 0);
             
-            RomanUI::drawSidebar(window, uiViewSize.x, uiViewSize.y, uiManager.getFont(), playerPos);
+            RomanUI::drawSidebar(drawTarget, uiViewSize.x, uiViewSize.y, uiManager.getFont(), playerPos);
             
             // Draw minimap in sidebar
             sf::Vector2f mapSize(MAP_WIDTH * HEX_WIDTH, MAP_HEIGHT * HEX_HEIGHT * 0.75f);
-            RomanUI::drawMinimap(window, uiViewSize.x - RomanUI::Layout::SIDEBAR_WIDTH + 20, 50, 
+            RomanUI::drawMinimap(drawTarget, uiViewSize.x - RomanUI::Layout::SIDEBAR_WIDTH + 20, 50, 
                                 RomanUI::Layout::MINIMAP_SIZE, gameView.getCenter(), mapSize);
             
             // Draw Roman border around the game area (excluding sidebar)
             float gameAreaWidth = uiViewSize.x - RomanUI::Layout::SIDEBAR_WIDTH - 20;
-            RomanUI::drawRomanBorder(window, 10, 10, gameAreaWidth, uiViewSize.y - 20);
+            RomanUI::drawRomanBorder(drawTarget, 10, 10, gameAreaWidth, uiViewSize.y - 20);
             
             // Show city interaction prompt when player is near a city
-            if (gameManager.getPlayerHero()) {
-                sf::Vector2f heroPos = gameManager.getPlayerHero()->getPosition();
-                auto& cities = cityManager.getCities();
-                bool nearCity = false;
-                std::string nearestCityName;
-                
-                for (const auto& city : cities) {
-                    sf::Vector2f cityPos = city.getPosition();
-                    float distance = std::sqrt(std::pow(heroPos.x - cityPos.x, 2) + 
-                                              std::pow(heroPos.y - cityPos.y, 2));
-                    if (distance < HEX_SIZE * 3.5f) {
-                        nearCity = true;
-                        nearestCityName = city.getName();
-                        break;
-                    }
-                }
-                
-                if (nearCity) {
-                    // Draw interaction prompt
-                    sf::RectangleShape promptBg(sf::Vector2f(300, 50));
-                    promptBg.setPosition(sf::Vector2f((gameAreaWidth - 300) / 2, uiViewSize.y - 100));
-                    promptBg.setFillColor(sf::Color(0, 0, 0, 180));
-                    promptBg.setOutlineColor(RomanUI::Colors::ROMAN_GOLD);
-                    promptBg.setOutlineThickness(2);
-                    window.draw(promptBg);
-                    
-                    sf::Text promptText(uiManager.getFont());
-                    promptText.setString("Press E to enter " + nearestCityName);
-                    promptText.setCharacterSize(14);
-                    promptText.setFillColor(RomanUI::Colors::ROMAN_GOLD);
-                    promptText.setPosition(sf::Vector2f((gameAreaWidth - 280) / 2, uiViewSize.y - 90));
-                    window.draw(promptText);
+            if (cityPrompt && !snapshot.ui.nearbyCityName.empty()) {
+                if (snapshot.ui.nearbyCityName != cityPromptName) {
+                    cityPromptName = snapshot.ui.nearbyCityName;
+                    cityPrompt->setString("Press E to enter " + cityPromptName);
                 }
+                cityPromptBackground.setPosition(sf::Vector2f((gameAreaWidth - 300) / 2, uiViewSize.y - 100));
+                drawTarget.draw(cityPromptBackground);
+                cityPrompt->setPosition(sf::Vector2f((gameAreaWidth - 280) / 2, uiViewSize.y - 90));
+                drawTarget.draw(*cityPrompt);
             }
             
+            uiTimer.stop();
+
             // Draw modals if open
+            ProfileScope modalTimer(renderTrack, modalScope);
             if (isModalOpen) {
                 float modalX = (uiViewSize.x - RomanUI::Layout::MODAL_WIDTH) / 2;
                 float modalY = (uiViewSize.y - RomanUI::Layout::MODAL_HEIGHT) / 2;
                 
                 switch (currentModal) {
                     case RomanUI::ModalType::CharacterManagement:
-                        RomanUI::drawCharacterModal(window, uiManager.getFont());
+                        RomanUI::drawCharacterModal(drawTarget, uiManager.getFont());
                         break;
                     case RomanUI::ModalType::ArmyManagement:
-                        RomanUI::drawArmyModal(window, uiManager.getFont());
+                        RomanUI::drawArmyModal(drawTarget, uiManager.getFont());
                         break;
                     case RomanUI::ModalType::SkillsManagement:
-                        RomanUI::drawSkillsModal(window, uiManager.getFont());
+                        RomanUI::drawSkillsModal(drawTarget, uiManager.getFont());
                         break;
                     case RomanUI::ModalType::CityManagement:
-                        RomanUI::drawCityModal(window, uiManager.getFont());
+                        RomanUI::drawCityModal(drawTarget, uiManager.getFont());
                         break;
                     case RomanUI::ModalType::BuildingManagement:
-                        RomanUI::drawBuildingModal(window, uiManager.getFont(), "City Center");
+                        RomanUI::drawBuildingModal(drawTarget, uiManager.getFont(), "City Center");
                         break;
                     case RomanUI::ModalType::Barracks:
-                        RomanUI::drawBuildingModal(window, uiManager.getFont(), "Barracks");
+                        RomanUI::drawBuildingModal(drawTarget, uiManager.getFont(), "Barracks");
                         break;
                     case RomanUI::ModalType::Market:
-                        RomanUI::drawBuildingModal(window, uiManager.getFont(), "Market");
+                        RomanUI::drawBuildingModal(drawTarget, uiManager.getFont(), "Market");
                         break;
                     case RomanUI::ModalType::Temple:
-                        RomanUI::drawBuildingModal(window, uiManager.getFont(), "Temple");
+                        RomanUI::drawBuildingModal(drawTarget, uiManager.getFont(), "Temple");
                         break;
                     default:
                         break;
                 }
             }
+            modalTimer.stop();
             window.setView(gameView);
         }
 
+        if (profilerOverlay && profilerOverlay->isVisible()) {
+            window.setView(uiView);
+            drawTarget.setCategory(DrawCategory::Overlay);
+            profilerOverlay->draw(drawTarget);
+            window.setView(gameState == GameState::MainMenu ? uiView : gameView);
+        }
+
+        ProfileScope displayTimer(renderTrack, displayScope);
         window.display();
+
+        if (!firstFramePresented) {
+            firstFramePresented = true;
+            LOG_INFO("startup", "First frame presented after {} ms", millisecondsSinceStartup());
+        }
     }
 
+    simulation.stop();
+    Log::stop();
     return 0;
 }
\ No newline at end of file
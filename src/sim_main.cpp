@@ -0,0 +1,295 @@
+// Headless driver: runs the simulation core for a number of turns without
+// a window and prints summary stats. Built as HexagonMapSim.
+#include "AllocationTracker.hpp"
+#include "Definitions.hpp"
+#include "FrameArena.hpp"
+#include "Log.hpp"
+#include "Simulation.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+
+namespace {
+
+struct SimOptions {
+    int turns = 100;
+    unsigned int seed = 1;
+    int mapWidth = 240;
+    int mapHeight = 180;
+    float hexSize = 30.0f;
+    float tickRate = 60.0f;
+    int extraCities = 0;     // Cities founded on top of the starting layout
+    int factions = 1;        // Extra cities are dealt round-robin to this many factions
+    int workerThreads = -1;  // Turn worker threads; -1 picks one per core
+    bool moveUnits = true;   // Give idle units random orders each turn
+    bool verbose = false;    // Keep the game's own console chatter
+    std::string tracePath;   // Write a Chrome trace of every tick here
+    std::string definitionsPath;  // Content definitions file; built-ins when empty
+};
+
+void printUsage(const char* program) {
+    std::cout << "Usage: " << program << " [options]\n"
+              << "  --turns N        turns to simulate (default 100)\n"
+              << "  --seed S         map and spawn seed (default 1)\n"
+              << "  --width W        map width in tiles (default 240)\n"
+              << "  --height H       map height in tiles (default 180)\n"
+              << "  --tick-rate R    simulation ticks per second (default 60)\n"
+              << "  --cities N       found up to N extra cities at random (default 0)\n"
+              << "  --factions N     deal the extra cities out to N factions (default 1)\n"
+              << "  --threads N      turn worker threads besides the main one (default: one per core)\n"
+              << "  --trace FILE     write a Chrome trace (chrome://tracing) of every tick\n"
+              << "  --definitions F  load unit, item and terrain definitions from F\n"
+              << "  --no-moves       leave units idle\n"
+              << "  --verbose        keep per-event logging\n";
+}
+
+// Returns false on bad arguments or --help
+bool parseArguments(int argc, char* argv[], SimOptions& options) {
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        bool hasValue = i + 1 < argc;
+
+        if (std::strcmp(arg, "--turns") == 0 && hasValue) {
+            options.turns = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "--seed") == 0 && hasValue) {
+            options.seed = static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(arg, "--width") == 0 && hasValue) {
+            options.mapWidth = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "--height") == 0 && hasValue) {
+            options.mapHeight = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "--tick-rate") == 0 && hasValue) {
+            options.tickRate = static_cast<float>(std::atof(argv[++i]));
+        } else if (std::strcmp(arg, "--cities") == 0 && hasValue) {
+            options.extraCities = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "--factions") == 0 && hasValue) {
+            options.factions = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "--threads") == 0 && hasValue) {
+            options.workerThreads = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "--trace") == 0 && hasValue) {
+            options.tracePath = argv[++i];
+        } else if (std::strcmp(arg, "--definitions") == 0 && hasValue) {
+            options.definitionsPath = argv[++i];
+        } else if (std::strcmp(arg, "--no-moves") == 0) {
+            options.moveUnits = false;
+        } else if (std::strcmp(arg, "--verbose") == 0) {
+            options.verbose = true;
+        } else {
+            return false;
+        }
+    }
+
+    // The starting layout places cities up to tile (20, 20)
+    if (options.turns < 0 || options.extraCities < 0 || options.factions < 1 || options.factions > 32 ||
+        options.mapWidth < 24 || options.mapHeight < 24 || options.tickRate <= 0.0f) {
+        return false;
+    }
+    return true;
+}
+
+// Try to found count cities on random land tiles; spacing rules reject some.
+// Founded cities go to factions 0..factions-1 in turn.
+int foundRandomCities(Simulation& simulation, int count, int factions, std::mt19937& rng) {
+    const auto& tileMap = simulation.getTileMap();
+    std::uniform_int_distribution<int> column(0, simulation.getMapWidth() - 1);
+    std::uniform_int_distribution<int> row(0, simulation.getMapHeight() - 1);
+    int founded = 0;
+
+    for (int attempt = 0; attempt < count; ++attempt) {
+        const game::Tile& tile = tileMap[column(rng)][row(rng)];
+        if (!Definitions::getTerrain(tile.type).walkable) continue;
+
+        Entity city = simulation.getCityManager().addCity(tile.center);
+        if (!city.isValid()) continue;
+
+        std::uint8_t faction = static_cast<std::uint8_t>(founded % factions);
+        if (faction != Faction::PLAYER) {
+            simulation.getWorld().factions.add(city, faction);
+        }
+        ++founded;
+    }
+    return founded;
+}
+
+// Send every idle unit to a random walkable tile a few hexes away.
+// Each path search works in scratch, which is emptied after every order.
+int orderIdleUnits(Simulation& simulation, std::mt19937& rng, FrameArena& scratch) {
+    const auto& tileMap = simulation.getTileMap();
+    UnitManager& unitManager = simulation.getUnitManager();
+    std::uniform_int_distribution<int> offset(-6, 6);
+    int orders = 0;
+
+    for (Entity unit : unitManager.getUnitEntities()) {
+        if (unitManager.isMoving(unit)) continue;
+
+        sf::Vector2i tile = simulation.worldToTile(*unitManager.getUnitPosition(unit));
+        int targetX = tile.x + offset(rng);
+        int targetY = tile.y + offset(rng);
+        if (targetX < 0 || targetX >= simulation.getMapWidth() ||
+            targetY < 0 || targetY >= simulation.getMapHeight()) {
+            continue;
+        }
+
+        if (!Definitions::getTerrain(tileMap[targetX][targetY].type).walkable) continue;
+
+        if (unitManager.moveUnitTo(unit, tileMap[targetX][targetY].center, tileMap, &scratch)) {
+            ++orders;
+        }
+        scratch.reset();
+    }
+    return orders;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    SimOptions options;
+    if (!parseArguments(argc, argv, options)) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    // Only errors reach the console, on stderr, unless asked for everything
+    Log::Options logOptions;
+    if (!options.verbose) {
+        logOptions.minimumLevel = Log::Level::Error;
+        logOptions.sink = stderr;
+    }
+    Log::start(logOptions);
+
+    if (!options.definitionsPath.empty() && !Definitions::load(options.definitionsPath)) {
+        Log::stop();
+        return 1;
+    }
+
+    auto wallStart = std::chrono::steady_clock::now();
+
+    Simulation simulation(options.mapWidth, options.mapHeight, options.hexSize, options.tickRate);
+    simulation.setSeed(options.seed);
+    if (options.workerThreads >= 0) {
+        simulation.setWorkerThreads(static_cast<unsigned int>(options.workerThreads));
+    }
+    simulation.initialize();
+
+    Profiler profiler;
+    if (!options.tracePath.empty()) {
+        simulation.setProfiler(profiler);
+        profiler.startCapture();
+    }
+
+    // Everything runs: units move and the turn clock counts down
+    simulation.setActivity(true, true);
+
+    std::mt19937 orderRng(options.seed);
+    FrameArena pathScratch;
+    if (options.extraCities > 0) {
+        foundRandomCities(simulation, options.extraCities, options.factions, orderRng);
+    }
+    int totalOrders = 0;
+    int lastTurn = simulation.getTurnNumber();
+    const int finalTurn = lastTurn + options.turns;
+
+    if (options.moveUnits) {
+        totalOrders += orderIdleUnits(simulation, orderRng, pathScratch);
+    }
+    AllocationTracker::Counters allocationsBefore = AllocationTracker::getTotalCounters();
+    while (simulation.getTurnNumber() < finalTurn) {
+        simulation.tick();
+        profiler.collect();
+
+        if (simulation.getTurnNumber() != lastTurn) {
+            lastTurn = simulation.getTurnNumber();
+            if (options.moveUnits) {
+                totalOrders += orderIdleUnits(simulation, orderRng, pathScratch);
+            }
+        }
+    }
+
+    double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+    AllocationTracker::Counters allocationsAfter = AllocationTracker::getTotalCounters();
+    Log::stop();
+
+    // Summary
+    const auto& cities = simulation.getCityManager().getCities();
+    int totalPopulation = 0;
+    int totalFood = 0;
+    int totalProduction = 0;
+    int totalGold = 0;
+    for (const auto& city : cities) {
+        totalPopulation += city.getPopulation();
+        totalFood += city.getFood();
+        totalProduction += city.getProduction();
+        totalGold += city.getGoldPerTurn();
+    }
+
+    std::cout << "seed            " << options.seed << "\n"
+              << "map             " << options.mapWidth << "x" << options.mapHeight << "\n"
+              << "turns           " << options.turns << "\n"
+              << "ticks           " << simulation.getTickCount() << "\n"
+              << "wall time       " << wallSeconds << " s\n"
+              << "threads         " << simulation.getThreadCount() << "\n"
+              << "units           " << simulation.getUnitManager().getUnitCount() << "\n"
+              << "move orders     " << totalOrders << "\n"
+              << "cities          " << cities.size() << "\n"
+              << "population      " << totalPopulation << "\n"
+              << "food/turn       " << totalFood << "\n"
+              << "production/turn " << totalProduction << "\n"
+              << "gold/turn       " << totalGold << "\n";
+
+    for (const auto& city : cities) {
+        std::cout << "  " << city.getName()
+                  << " pop " << city.getPopulation()
+                  << " food " << city.getFood()
+                  << " prod " << city.getProduction()
+                  << " gold " << city.getGoldPerTurn()
+                  << " building " << game::GameCity::getItemName(city.getCurrentProduction())
+                  << " (" << city.getProductionProgress() << "/" << city.getProductionNeeded() << ")\n";
+    }
+
+    // What each faction sees now and has explored, plus the tiles they all see
+    if (options.factions > 1) {
+        const Visibility& visibility = simulation.getVisibility();
+        for (int f = 0; f < options.factions; ++f) {
+            std::uint8_t faction = static_cast<std::uint8_t>(f);
+            std::cout << "faction " << f
+                      << " visible " << visibility.getVisible(faction).count()
+                      << " explored " << visibility.getRevealed(faction).count() << "\n";
+        }
+
+        TileBitset shared;
+        std::uint32_t allFactions = options.factions == 32 ? ~0u : (1u << options.factions) - 1;
+        visibility.intersectVisible(allFactions, shared);
+        std::cout << "seen by all     " << shared.count() << "\n";
+    }
+
+    if (!options.tracePath.empty()) {
+        if (profiler.writeChromeTrace(options.tracePath)) {
+            std::cout << "trace           " << options.tracePath << " (" << profiler.getCapturedCount() << " samples)\n";
+        } else {
+            std::cout << "trace           could not write " << options.tracePath << "\n";
+        }
+    }
+
+    // Turn stage costs; timings vary run to run, so they come last
+    const TurnPipeline& pipeline = simulation.getTurnPipeline();
+    for (const auto& stage : pipeline.getTimings()) {
+        double average = pipeline.getTurnsRun() > 0 ? stage.totalMilliseconds / pipeline.getTurnsRun() : 0.0;
+        std::cout << "stage " << stage.name << " avg " << average << " ms max " << stage.maxMilliseconds << " ms\n";
+    }
+
+    // Heap traffic of the run loop, in builds with the allocation hook
+    if (AllocationTracker::isEnabled()) {
+        std::uint64_t allocations = allocationsAfter.allocations - allocationsBefore.allocations;
+        std::uint64_t bytes = allocationsAfter.bytes - allocationsBefore.bytes;
+        double ticks = std::max<double>(1.0, static_cast<double>(simulation.getTickCount()));
+        std::cout << "allocations     " << allocations << " (" << allocations / ticks << " per tick, "
+                  << bytes / ticks << " bytes per tick)\n"
+                  << "no-alloc faults " << AllocationTracker::getViolationCount() << "\n";
+    }
+
+    return 0;
+}